@@ -0,0 +1,11 @@
+#include <BIC/FixedArray.hpp>
+#include <BIC/Seq.hpp>
+
+template<size_t... VALUES>
+constexpr bool checkContains(BIC::FixedIndices<VALUES...> array)
+{
+	return (BIC::contains(array, BIC::fixed<size_t, VALUES>) and ...);
+}
+
+static_assert(checkContains(BIC::indexSeq<0, BIC_BENCH_N>));
+static_assert(not BIC::contains(BIC::indexSeq<0, BIC_BENCH_N>, BIC::fixed<size_t, BIC_BENCH_N>));
@@ -0,0 +1,10 @@
+#include <BIC/FixedArrayElement.hpp>
+#include <BIC/Seq.hpp>
+
+template<size_t... VALUES>
+constexpr bool checkElements(BIC::FixedIndices<VALUES...>)
+{
+	return []<size_t... Is>(BIC::FixedIndices<Is...>) { return ((BIC::FixedArrayElement<Is, size_t, VALUES...>::value == Is) and ...); }(BIC::FixedIndices<VALUES...>{});
+}
+
+static_assert(checkElements(BIC::indexSeq<0, BIC_BENCH_N>));
@@ -0,0 +1,5 @@
+#include <BIC/Seq.hpp>
+
+using Sequence = BIC::IndexSeq<0, 2*BIC_BENCH_N, 2>;
+
+static_assert(Sequence::size == BIC_BENCH_N);
@@ -0,0 +1,7 @@
+#include <BIC/Reversed.hpp>
+#include <BIC/Seq.hpp>
+
+using Sequence = BIC::IndexSeq<0, BIC_BENCH_N>;
+using Reversed = decltype(BIC::reversed(Sequence{}));
+
+static_assert(Reversed::values.front() == BIC_BENCH_N - 1 and Reversed::values.back() == 0);
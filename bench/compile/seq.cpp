@@ -0,0 +1,5 @@
+#include <BIC/Seq.hpp>
+
+using Sequence = BIC::Seq<size_t, 0, BIC_BENCH_N>;
+
+static_assert(Sequence::size == BIC_BENCH_N);
@@ -0,0 +1,6 @@
+#include <BIC/FixedArray.hpp>
+#include <BIC/Seq.hpp>
+
+using Odds = decltype(BIC::substract(BIC::indexSeq<0, BIC_BENCH_N>, BIC::indexSeq<0, BIC_BENCH_N, 2>));
+
+static_assert(Odds::size == BIC_BENCH_N/2);
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Compile-time throughput benchmark of the BIC metaprogramming core.
+
+Compiles every case of bench/compile/ for each requested size with
+-DBIC_BENCH_N=<size> and records the wall time and the peak memory of the
+compiler. Results are written as JSON and CSV so that they can be tracked
+over time.
+"""
+
+import argparse
+import csv
+import json
+import os
+import platform
+import subprocess
+import sys
+import threading
+import time
+
+
+def measure(command, timeout):
+    """Run `command`, return (status, seconds, peak memory in KiB, stderr)."""
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+
+    # Read stderr in the background so that a verbose compiler cannot block on a full pipe
+    stderr = []
+    reader = threading.Thread(target=lambda: stderr.append(process.stderr.read()))
+    reader.start()
+
+    timed_out = False
+    while True:
+        pid, status, usage = os.wait4(process.pid, os.WNOHANG)
+        if pid != 0:
+            break
+        if time.perf_counter() - start > timeout:
+            process.kill()
+            pid, status, usage = os.wait4(process.pid, 0)
+            timed_out = True
+            break
+        time.sleep(0.005)
+
+    seconds = time.perf_counter() - start
+    reader.join()
+
+    # ru_maxrss is in KiB on Linux but in bytes on macOS
+    peak = usage.ru_maxrss // 1024 if platform.system() == "Darwin" else usage.ru_maxrss
+
+    if timed_out:
+        result = "timeout"
+    elif os.waitstatus_to_exitcode(status) != 0:
+        result = "error"
+    else:
+        result = "ok"
+
+    return result, seconds, peak, b"".join(stderr).decode(errors="replace")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--compiler", required=True, help="C++ compiler to benchmark")
+    parser.add_argument("--include", required=True, help="BIC include directory")
+    parser.add_argument("--cases", required=True, help="directory holding the benchmark translation units")
+    parser.add_argument("--output", required=True, help="output file prefix, .json and .csv are appended")
+    parser.add_argument("--sizes", default="16;256;1024;4096", help="semicolon separated list of sizes")
+    parser.add_argument("--repeat", type=int, default=1, help="number of runs per measurement, the fastest is kept")
+    parser.add_argument("--timeout", type=float, default=300, help="timeout of a single compilation in seconds")
+    parser.add_argument("--flags", default="", help="semicolon separated list of extra compiler flags")
+    args = parser.parse_args()
+
+    sizes = [int(size) for size in args.sizes.split(";") if size]
+    flags = [flag for flag in args.flags.split(";") if flag]
+    cases = sorted(name for name in os.listdir(args.cases) if name.endswith(".cpp"))
+
+    results = []
+    for case in cases:
+        for size in sizes:
+            command = [args.compiler, "-std=c++20", "-fsyntax-only", "-I", args.include, f"-DBIC_BENCH_N={size}", *flags, os.path.join(args.cases, case)]
+
+            runs = [measure(command, args.timeout) for _ in range(args.repeat)]
+            status, seconds, peak, stderr = min(runs, key=lambda run: run[1])
+
+            name = case[:-len(".cpp")]
+            results.append({"case": name, "size": size, "status": status, "seconds": round(seconds, 4), "peak_memory_kib": peak})
+            print(f"{name:>12} N={size:<6} {status:>8} {seconds:8.3f} s {peak:>9} KiB", flush=True)
+
+            if status == "error" and stderr:
+                lines = stderr.strip().splitlines()
+                print("    " + next((line for line in lines if "error" in line), lines[-1])[:200], flush=True)
+
+    report = {
+        "compiler": args.compiler,
+        "version": subprocess.run([args.compiler, "--version"], capture_output=True, text=True).stdout.splitlines()[0],
+        "flags": flags,
+        "results": results,
+    }
+
+    with open(args.output + ".json", "w") as file:
+        json.dump(report, file, indent=2)
+
+    with open(args.output + ".csv", "w", newline="") as file:
+        writer = csv.DictWriter(file, fieldnames=["case", "size", "status", "seconds", "peak_memory_kib"])
+        writer.writeheader()
+        writer.writerows(results)
+
+    print(f"report written to {args.output}.json and {args.output}.csv")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,112 @@
+// Runtime benchmark of BIC::sort on tiny arrays.
+//
+// Sorts many independent arrays of N floats, for N from 2 to 64, with the
+// sorting network (N is a Fixed), with the insertion sort fallback (N is a
+// runtime value) and with std::sort, checks that every array comes out
+// sorted, and reports the time per array.
+// Before timing, it checks that records with many equal keys come out
+// sorted and as a permutation of the input.
+
+#include <BIC/Sort.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t TOTAL_ELEMENTS = size_t(1) << 22; // elements sorted per measurement, split into arrays of N elements
+constexpr int    REPEAT         = 5;               // the fastest run is reported
+
+template<typename Sort>
+double nanosecondsPerArray(const std::vector<float>& input, const size_t n, Sort&& sort)
+{
+	std::vector<float> data(input.size());
+
+	double best = 0;
+	for (int run = 0; run != REPEAT; ++run)
+	{
+		data = input;
+
+		const auto start = std::chrono::steady_clock::now();
+		for (size_t offset = 0; offset + n <= data.size(); offset += n) { sort(data.data() + offset); }
+		const auto stop = std::chrono::steady_clock::now();
+
+		for (size_t offset = 0; offset + n <= data.size(); offset += n)
+		{
+			const auto first = data.begin() + static_cast<std::ptrdiff_t>(offset);
+			if (not std::is_sorted(first, first + static_cast<std::ptrdiff_t>(n))) { std::fprintf(stderr, "unsorted output for N = %zu\n", n); break; }
+		}
+
+		const double elapsed = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(data.size() / n);
+		best = run == 0 ? elapsed : std::min(best, elapsed);
+	}
+	return best;
+}
+
+// Sorts records by a key taking few values, so that most comparisons are between equal keys
+template<size_t N>
+bool sortsRecordsWithEqualKeys(std::mt19937& generator)
+{
+	using Record = std::pair<int, int>;
+
+	const auto byKey = [](const Record& lhs, const Record& rhs) { return lhs.first < rhs.first; };
+
+	std::uniform_int_distribution<int> key(0, 2);
+
+	Record input[N];
+	for (size_t i = 0; i != N; ++i) { input[i] = {key(generator), static_cast<int>(i)}; }
+
+	Record network[N];
+	Record insertion[N];
+	std::copy(input, input + N, network);
+	std::copy(input, input + N, insertion);
+	BIC::sort(network, BIC::fixed<size_t, N>, byKey);
+	BIC::sort(insertion, N, byKey);
+
+	return std::is_sorted(network, network + N, byKey) and std::is_permutation(network, network + N, input)
+	   and std::is_sorted(insertion, insertion + N, byKey) and std::is_permutation(insertion, insertion + N, input);
+}
+
+template<size_t N>
+void benchmark(const std::vector<float>& input)
+{
+	std::mt19937 generator(N);
+	for (int trial = 0; trial != 100; ++trial)
+	{
+		if (not sortsRecordsWithEqualKeys<N>(generator)) { std::fprintf(stderr, "records with equal keys are not permuted for N = %zu\n", N); break; }
+	}
+
+	const double network   = nanosecondsPerArray(input, N, [](float* const data) { BIC::sort(data, BIC::fixed<size_t, N>); });
+	const double insertion = nanosecondsPerArray(input, N, [n = N](float* const data) { BIC::sort(data, n); });
+	const double standard  = nanosecondsPerArray(input, N, [](float* const data) { std::sort(data, data + N); });
+
+	std::printf("%4zu %10zu %12.1f %12.1f %12.1f %9.2fx\n", N, BIC::detail::SortingNetworkPairs<N>::COUNT, network, insertion, standard, standard / network);
+}
+
+template<size_t... Ns>
+void benchmarkAll(const std::vector<float>& input, std::index_sequence<Ns...>)
+{
+	(benchmark<Ns + 2>(input), ...);
+}
+
+} // namespace
+
+int main()
+{
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+	std::vector<float> input(TOTAL_ELEMENTS);
+	for (float& value : input) { value = distribution(generator); }
+
+	std::printf("%4s %10s %12s %12s %12s %10s\n", "N", "comparators", "network ns", "insertion ns", "std::sort ns", "speedup");
+	benchmarkAll(input, std::make_index_sequence<63>{});
+
+	return 0;
+}
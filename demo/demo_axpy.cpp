@@ -1,5 +1,7 @@
 #include <BIC/Core.hpp>
 
+#include <array>
+#include <utility>
 #include <vector>
 #include <fmt/ranges.h>
 
@@ -12,6 +14,25 @@ void axpy(const Alpha alpha, const Scalar* x, const Size N, Scalar* y)
     }
 }
 
+// Runtime sizes are split into tiles of Fixed length, 
+// only the tail goes through the runtime size loop
+template<typename Alpha, typename Scalar>
+void tiledAxpy(const Alpha alpha, const Scalar* x, const size_t N, Scalar* y)
+{
+	BIC::foreachTiled(size_t(0), N, BIC::fixed<size_t, 8>, [&](const size_t i, const auto tileSize)
+	{
+		axpy(alpha, x + i, tileSize, y + i);
+	});
+}
+
+// With FixedSpan the size travels with the pointer, 
+// and is a BIC::Fixed whenever it is known at compile time
+template<typename Alpha, typename Scalar, typename Extent>
+void axpy(const Alpha alpha, const BIC::FixedSpan<const Scalar, Extent> x, const BIC::FixedSpan<Scalar, Extent> y)
+{
+	axpy(alpha, x.data(), y.size(), y.data());
+}
+
 int main()
 {
 	constexpr size_t N = 20;
@@ -29,6 +50,16 @@ int main()
 	axpy(BIC::fixed<double,1.>, x.data(), BIC::fixed<size_t, N>, y.data());
 	
 	fmt::print("y = {}\n", fmt::join(y, ", "));
+	// tiled axpy, the size is not fixed but the tiles are
+	tiledAxpy(BIC::fixed<double,1.>, x.data(), x.size(), y.data());
+	
+	fmt::print("y = {}\n", fmt::join(y, ", "));
+	// axpy on views, the extent of a std::array is a BIC::Fixed
+	std::array<double, N> a; a.fill(1);
+	std::array<double, N> b; b.fill(2);
+	axpy(BIC::fixed<double,1.>, BIC::FixedSpan(std::as_const(a)), BIC::FixedSpan(b));
+	
+	fmt::print("b = {}\n", fmt::join(b, ", "));
 	
 	return EXIT_SUCCESS;
 }
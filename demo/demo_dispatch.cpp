@@ -0,0 +1,53 @@
+#include <BIC/Core.hpp>
+
+#include <cstdlib>
+#include <vector>
+#include <fmt/ranges.h>
+
+template<typename Alpha, typename Scalar, typename Size>
+void axpy(const Alpha alpha, const Scalar* x, const Size N, Scalar* y)
+{
+    for (BIC::Mutable<Size> i=0; i!=N; ++i)
+    {
+        y[i] += alpha*x[i];
+    }
+}
+
+int main(int argc, char* argv[])
+{
+	// the size is only known at runtime
+	const size_t N = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 12;
+	
+	std::vector<double> x(N, 1);
+	std::vector<double> y(N, 2);
+	
+	// dense candidates: dispatched through a jump table
+	BIC::dispatch(N, BIC::seq<size_t, 1, 17>, [&](const auto n)
+	{
+		fmt::print("dense dispatch, n = {} is n fixed ? {}\n", n, BIC::isFixed(n));
+		axpy(BIC::fixed<double,1.>, x.data(), n, y.data());
+	});
+	
+	// sparse candidates: dispatched through a branch tree
+	BIC::dispatch(N, BIC::fixedArray<size_t, 12, 64, 256, 1024>, [&](const auto n)
+	{
+		fmt::print("sparse dispatch, n = {} is n fixed ? {}\n", n, BIC::isFixed(n));
+		axpy(BIC::fixed<double,1.>, x.data(), n, y.data());
+	}, 
+	[&](const size_t n)
+	{
+		fmt::print("sparse dispatch, no candidate for n = {}\n", n);
+		axpy(1., x.data(), n, y.data());
+	});
+	
+	// cartesian dispatch: at most 16 instantiations, so the second dimension is passed as a size_t
+	const size_t M = N/2;
+	BIC::dispatch<16>(std::tuple{N, M}, std::tuple{BIC::seq<size_t, 8, 24, 2>, BIC::seq<size_t, 4, 12>}, [&](const auto n, const auto m)
+	{
+		fmt::print("cartesian dispatch, (n, m) = ({}, {}) are they fixed ? ({}, {})\n", n, m, BIC::isFixed(n), BIC::isFixed(m));
+	});
+	
+	fmt::print("y = {}\n", fmt::join(y, ", "));
+	
+	return EXIT_SUCCESS;
+}
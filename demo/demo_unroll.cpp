@@ -0,0 +1,45 @@
+#include <BIC/Core.hpp>
+
+#include <array>
+#include <numeric>
+#include <vector>
+#include <fmt/core.h>
+
+// Sums x[0..N) using one accumulator per lane of the unrolled block, 
+// which breaks the dependency chain of the floating point additions.
+template<int N, size_t BLOCK_SIZE>
+double sum(const double* x)
+{
+	std::array<double, BLOCK_SIZE> acc = {};
+	
+	BIC::foreach(BIC::unrollPolicy<64, BLOCK_SIZE>, BIC::fixed<int,0>, BIC::fixed<int,N>, [&](const auto i, const auto lane)
+	{
+		acc[lane] += x[i];
+	});
+	
+	return std::accumulate(acc.begin(), acc.end(), 0.);
+}
+
+int main()
+{
+	constexpr int N = 4096;
+	
+	std::vector<double> x(N);
+	std::iota(x.begin(), x.end(), 0.);
+	
+	fmt::print("sum of the first {} integers : {}\n", N, sum<N, 4>(x.data()));
+	
+	fmt::print("short loops are still fully unrolled\n");
+	BIC::foreach(BIC::DefaultUnrollPolicy{}, BIC::fixed<int,0>, BIC::fixed<int,4>, [](const auto i)
+	{
+		fmt::print("i = {} is i fixed ? {}\n", i, BIC::isFixed(i));
+	});
+	
+	fmt::print("long loops are unrolled by blocks, the remainder is fully unrolled\n");
+	BIC::foreach(BIC::unrollPolicy<4, 4>, BIC::fixed<int,0>, BIC::fixed<int,10>, [](const auto i, const auto lane)
+	{
+		fmt::print("i = {} is i fixed ? {}, lane = {} is lane fixed ? {}\n", i, BIC::isFixed(i), lane, BIC::isFixed(lane));
+	});
+	
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,339 @@
+#ifndef BIC_ALGORITHMS_HPP
+#define BIC_ALGORITHMS_HPP
+
+/**
+ * @file Algorithms.hpp
+ * @brief Compile-time algorithms on FixedArray.
+ * @date 2025
+ * @version 1.0
+ *
+ * Every algorithm returns a `Fixed` or a `FixedArray` type. They are all
+ * implemented with constexpr `std::array` algorithms evaluated once per call
+ * site, rather than with per-element template recursion, so that their cost
+ * in template instantiations stays linear in the size of the inputs.
+ *
+ * Example:
+ * @code
+ * constexpr auto fields = BIC::unite(BIC::fixedArray<int, 3, 1, 2>, BIC::fixedArray<int, 2, 5>); // FixedArray<int, 3, 1, 2, 5>
+ * constexpr auto sorted = BIC::sort(fields);                                                      // FixedArray<int, 1, 2, 3, 5>
+ * constexpr auto offsets = BIC::exclusiveScan(BIC::fixedArray<size_t, 4, 8, 2>);                     // FixedArray<size_t, 0, 4, 12>
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedArray.hpp>
+
+#include <algorithm> // for std::sort, std::transform, std::min_element, std::max_element
+#include <array>
+#include <cstddef>
+#include <functional> // for std::less, std::plus
+#include <numeric>    // for std::inclusive_scan, std::exclusive_scan
+#include <type_traits>
+#include <utility>
+
+namespace BIC
+{
+
+// ============================================================================
+// Set algebra
+// ============================================================================
+
+namespace detail
+{
+
+template<typename LhsArray, typename RhsArray>
+struct FixedArrayIntersect;
+
+template<typename T, T... LHS_VALUES, T... RHS_VALUES>
+struct FixedArrayIntersect< FixedArray<T, LHS_VALUES...>, FixedArray<T, RHS_VALUES...> >
+{
+	static constexpr ValueBuffer<T, sizeof...(LHS_VALUES)> VALUES = []
+	{
+		ValueBuffer<T, sizeof...(LHS_VALUES)> result = {};
+		for (const T value : FixedArray<T, LHS_VALUES...>::values)
+		{
+			if (packContains<T, RHS_VALUES...>(value)) { result.push_back(value); }
+		}
+		return result;
+	}();
+
+	using Type = typename FixedArrayFromArray<VALUES>::Type;
+};
+
+template<typename Array>
+struct FixedArrayUnique;
+
+template<typename T, T... VALUES>
+struct FixedArrayUnique< FixedArray<T, VALUES...> >
+{
+	static constexpr size_t SIZE = sizeof...(VALUES);
+
+	// Sorting (value, position) pairs finds the first occurrence of every value in O(N log N)
+	static constexpr ValueBuffer<T, SIZE> UNIQUE = []
+	{
+		std::array<std::pair<T, size_t>, SIZE> sorted = {};
+		for (size_t i = 0; i != SIZE; ++i) { sorted[i] = {FixedArray<T, VALUES...>::values[i], i}; }
+		std::sort(sorted.begin(), sorted.end());
+
+		std::array<bool, SIZE> first = {};
+		for (size_t i = 0; i != SIZE; ++i) { first[sorted[i].second] = i == 0 or sorted[i - 1].first != sorted[i].first; }
+
+		ValueBuffer<T, SIZE> result = {};
+		for (size_t i = 0; i != SIZE; ++i)
+		{
+			if (first[i]) { result.push_back(FixedArray<T, VALUES...>::values[i]); }
+		}
+		return result;
+	}();
+
+	using Type = typename FixedArrayFromArray<UNIQUE>::Type;
+};
+
+} // namespace detail
+
+/**
+ * @brief Values of `lhs` that belong to `rhs`, in the order (and with the duplicates) of `lhs`.
+ */
+template<typename T, T... LHS_VALUES, T... RHS_VALUES>
+constexpr typename detail::FixedArrayIntersect< FixedArray<T, LHS_VALUES...>, FixedArray<T, RHS_VALUES...> >::Type intersect(const FixedArray<T, LHS_VALUES...>, const FixedArray<T, RHS_VALUES...>) { return {}; }
+
+/**
+ * @brief Values of `array` without duplicates, each value at the position of its first occurrence.
+ */
+template<typename T, T... VALUES>
+constexpr typename detail::FixedArrayUnique< FixedArray<T, VALUES...> >::Type unique(const FixedArray<T, VALUES...>) { return {}; }
+
+/**
+ * @brief Union of `lhs` and `rhs` without duplicates: the values of `lhs`, then the values of `rhs` not already present.
+ */
+template<typename T, T... LHS_VALUES, T... RHS_VALUES>
+constexpr typename detail::FixedArrayUnique< FixedArray<T, LHS_VALUES..., RHS_VALUES...> >::Type unite(const FixedArray<T, LHS_VALUES...>, const FixedArray<T, RHS_VALUES...>) { return {}; }
+
+// ============================================================================
+// Ordering
+// ============================================================================
+
+namespace detail
+{
+
+template<typename Array, typename Compare>
+struct FixedArraySort;
+
+template<typename T, T... VALUES, typename Compare>
+struct FixedArraySort< FixedArray<T, VALUES...>, Compare >
+{
+	static constexpr std::array<T, sizeof...(VALUES)> SORTED = []
+	{
+		std::array<T, sizeof...(VALUES)> sorted = {VALUES...};
+		std::sort(sorted.begin(), sorted.end(), Compare{});
+		return sorted;
+	}();
+
+	using Type = typename FixedArrayFromArray<SORTED>::Type;
+};
+
+template<typename Array, typename Predicate>
+struct FixedArrayPartition;
+
+template<typename T, T... VALUES, typename Predicate>
+struct FixedArrayPartition< FixedArray<T, VALUES...>, Predicate >
+{
+	static constexpr std::array<T, sizeof...(VALUES)> PARTITIONED = []
+	{
+		std::array<T, sizeof...(VALUES)> partitioned = {};
+		size_t i = 0;
+		for (const T value : FixedArray<T, VALUES...>::values) { if (    Predicate{}(value)) { partitioned[i++] = value; } }
+		for (const T value : FixedArray<T, VALUES...>::values) { if (not Predicate{}(value)) { partitioned[i++] = value; } }
+		return partitioned;
+	}();
+
+	static constexpr size_t POINT = []
+	{
+		size_t point = 0;
+		for (const T value : FixedArray<T, VALUES...>::values) { point += Predicate{}(value) ? size_t(1) : size_t(0); }
+		return point;
+	}();
+
+	using Type = typename FixedArrayFromArray<PARTITIONED>::Type;
+};
+
+template<typename T, T VALUE, T... VALUES>
+constexpr size_t packIndexOf()
+{
+	size_t i = 0;
+	for (const T value : FixedArray<T, VALUES...>::values)
+	{
+		if (value == VALUE) { return i; }
+		++i;
+	}
+	return i;
+}
+
+} // namespace detail
+
+/**
+ * @brief Values of `array` sorted according to `Compare` (ascending by default).
+ *
+ * @tparam Compare Default constructible constexpr comparator, e.g. `std::greater<>` or a captureless lambda.
+ */
+template<typename T, T... VALUES, typename Compare = std::less<>>
+constexpr typename detail::FixedArraySort< FixedArray<T, VALUES...>, Compare >::Type sort(const FixedArray<T, VALUES...>, const Compare = {}) { return {}; }
+
+/**
+ * @brief Values of `array` for which `Predicate` holds, followed by the others, both in their original order.
+ *
+ * @tparam Predicate Default constructible constexpr predicate, e.g. a captureless lambda.
+ *
+ * The number of values satisfying the predicate is given by `partitionPoint`.
+ */
+template<typename T, T... VALUES, typename Predicate>
+constexpr typename detail::FixedArrayPartition< FixedArray<T, VALUES...>, Predicate >::Type partition(const FixedArray<T, VALUES...>, const Predicate) { return {}; }
+
+/**
+ * @brief Number of values of `array` for which `Predicate` holds, i.e. the position of the first value of the second group of `partition`.
+ */
+template<typename T, T... VALUES, typename Predicate>
+constexpr Fixed<size_t, detail::FixedArrayPartition< FixedArray<T, VALUES...>, Predicate >::POINT> partitionPoint(const FixedArray<T, VALUES...>, const Predicate) { return {}; }
+
+/**
+ * @brief Position of the first occurrence of `VALUE` in `array`, `array.size` when it is absent.
+ */
+template<typename T, T VALUE, T... VALUES>
+constexpr Fixed<size_t, detail::packIndexOf<T, VALUE, VALUES...>()> indexOf(const FixedArray<T, VALUES...>, const Fixed<T, VALUE>) { return {}; }
+
+// ============================================================================
+// Reductions and scans
+// ============================================================================
+
+namespace detail
+{
+
+template<typename Array, typename UnaryOp>
+struct FixedArrayTransform;
+
+template<typename T, T... VALUES, typename UnaryOp>
+struct FixedArrayTransform< FixedArray<T, VALUES...>, UnaryOp >
+{
+	using R = std::remove_cvref_t<std::invoke_result_t<UnaryOp, T>>;
+
+	static constexpr std::array<R, sizeof...(VALUES)> TRANSFORMED = []
+	{
+		std::array<R, sizeof...(VALUES)> transformed = {};
+		std::transform(FixedArray<T, VALUES...>::values.begin(), FixedArray<T, VALUES...>::values.end(), transformed.begin(), UnaryOp{});
+		return transformed;
+	}();
+
+	using Type = typename FixedArrayFromArray<TRANSFORMED>::Type;
+};
+
+template<typename Array, typename BinaryOp, auto INIT>
+struct FixedArrayScan;
+
+template<typename T, T... VALUES, typename BinaryOp, auto INIT>
+struct FixedArrayScan< FixedArray<T, VALUES...>, BinaryOp, INIT >
+{
+	static constexpr T REDUCED = []
+	{
+		T reduced = static_cast<T>(INIT);
+		for (const T value : FixedArray<T, VALUES...>::values) { reduced = static_cast<T>(BinaryOp{}(reduced, value)); }
+		return reduced;
+	}();
+
+	static constexpr std::array<T, sizeof...(VALUES)> INCLUSIVE = []
+	{
+		std::array<T, sizeof...(VALUES)> scanned = {};
+		std::inclusive_scan(FixedArray<T, VALUES...>::values.begin(), FixedArray<T, VALUES...>::values.end(), scanned.begin(), [](const T lhs, const T rhs) { return static_cast<T>(BinaryOp{}(lhs, rhs)); });
+		return scanned;
+	}();
+
+	static constexpr std::array<T, sizeof...(VALUES)> EXCLUSIVE = []
+	{
+		std::array<T, sizeof...(VALUES)> scanned = {};
+		std::exclusive_scan(FixedArray<T, VALUES...>::values.begin(), FixedArray<T, VALUES...>::values.end(), scanned.begin(), static_cast<T>(INIT), [](const T lhs, const T rhs) { return static_cast<T>(BinaryOp{}(lhs, rhs)); });
+		return scanned;
+	}();
+};
+
+template<typename T, T... VALUES>
+struct FixedArrayExtrema
+{
+	static_assert(sizeof...(VALUES) > 0, "BIC: the extrema of an empty FixedArray are undefined");
+
+	static constexpr size_t ARGMIN = static_cast<size_t>(std::min_element(FixedArray<T, VALUES...>::values.begin(), FixedArray<T, VALUES...>::values.end()) - FixedArray<T, VALUES...>::values.begin());
+	static constexpr size_t ARGMAX = static_cast<size_t>(std::max_element(FixedArray<T, VALUES...>::values.begin(), FixedArray<T, VALUES...>::values.end()) - FixedArray<T, VALUES...>::values.begin());
+
+	static constexpr T MIN = FixedArray<T, VALUES...>::values[ARGMIN];
+	static constexpr T MAX = FixedArray<T, VALUES...>::values[ARGMAX];
+};
+
+} // namespace detail
+
+/**
+ * @brief `UnaryOp` applied to every value of `array`.
+ *
+ * @tparam UnaryOp Default constructible constexpr function, e.g. a captureless lambda.
+ */
+template<typename T, T... VALUES, typename UnaryOp>
+constexpr typename detail::FixedArrayTransform< FixedArray<T, VALUES...>, UnaryOp >::Type transform(const FixedArray<T, VALUES...>, const UnaryOp) { return {}; }
+
+/**
+ * @brief Left fold of the values of `array` with `BinaryOp`, starting from `INIT`: `op(op(op(INIT, v0), v1), ...)`.
+ *
+ * @tparam BinaryOp Default constructible constexpr function, `std::plus<>` by default; its results are converted to `T`.
+ */
+template<typename T, T... VALUES, T INIT, typename BinaryOp = std::plus<>>
+constexpr Fixed<T, detail::FixedArrayScan< FixedArray<T, VALUES...>, BinaryOp, INIT >::REDUCED> reduce(const FixedArray<T, VALUES...>, const Fixed<T, INIT>, const BinaryOp = {}) { return {}; }
+
+/**
+ * @brief Sum of the values of `array`.
+ */
+template<typename T, T... VALUES>
+constexpr auto reduce(const FixedArray<T, VALUES...> array) { return reduce(array, Fixed<T, T(0)>{}); }
+
+/**
+ * @brief Prefix folds of `array` with `BinaryOp`: the `i`-th value folds the values `0` to `i` included.
+ */
+template<typename T, T... VALUES, typename BinaryOp = std::plus<>>
+constexpr typename detail::FixedArrayFromArray<detail::FixedArrayScan< FixedArray<T, VALUES...>, BinaryOp, T(0) >::INCLUSIVE>::Type inclusiveScan(const FixedArray<T, VALUES...>, const BinaryOp = {}) { return {}; }
+
+/**
+ * @brief Prefix folds of `array` with `BinaryOp` starting from `INIT`: the `i`-th value folds `INIT` and the values `0` to `i` excluded.
+ *
+ * The exclusive prefix sum of sizes gives the offsets at which they are laid out one after the other.
+ */
+template<typename T, T... VALUES, T INIT, typename BinaryOp = std::plus<>>
+constexpr typename detail::FixedArrayFromArray<detail::FixedArrayScan< FixedArray<T, VALUES...>, BinaryOp, INIT >::EXCLUSIVE>::Type exclusiveScan(const FixedArray<T, VALUES...>, const Fixed<T, INIT>, const BinaryOp = {}) { return {}; }
+
+/**
+ * @brief Exclusive prefix sums of `array`, starting from 0.
+ */
+template<typename T, T... VALUES>
+constexpr auto exclusiveScan(const FixedArray<T, VALUES...> array) { return exclusiveScan(array, Fixed<T, T(0)>{}); }
+
+/**
+ * @brief Smallest value of a non empty `array`.
+ */
+template<typename T, T... VALUES>
+constexpr Fixed<T, detail::FixedArrayExtrema<T, VALUES...>::MIN> min(const FixedArray<T, VALUES...>) { return {}; }
+
+/**
+ * @brief Largest value of a non empty `array`.
+ */
+template<typename T, T... VALUES>
+constexpr Fixed<T, detail::FixedArrayExtrema<T, VALUES...>::MAX> max(const FixedArray<T, VALUES...>) { return {}; }
+
+/**
+ * @brief Position of the first occurrence of the smallest value of a non empty `array`.
+ */
+template<typename T, T... VALUES>
+constexpr Fixed<size_t, detail::FixedArrayExtrema<T, VALUES...>::ARGMIN> argmin(const FixedArray<T, VALUES...>) { return {}; }
+
+/**
+ * @brief Position of the first occurrence of the largest value of a non empty `array`.
+ */
+template<typename T, T... VALUES>
+constexpr Fixed<size_t, detail::FixedArrayExtrema<T, VALUES...>::ARGMAX> argmax(const FixedArray<T, VALUES...>) { return {}; }
+
+} // namespace BIC
+
+#endif // BIC_ALGORITHMS_HPP
@@ -0,0 +1,429 @@
+#ifndef BIC_BOUNDED_HPP
+#define BIC_BOUNDED_HPP
+
+/**
+ * @file Bounded.hpp
+ * @brief Runtime integers whose range is known at compile time.
+ * @date 2025
+ * @version 1.0
+ *
+ * `BIC::Bounded<T, LO, HI>` holds a runtime value of type `T` known to lie
+ * in `[LO, HI]`. It sits between a `Fixed`, whose value is known at compile
+ * time, and a plain `T`:
+ *  - it is stored in the smallest integer type holding `[LO, HI]`, so an
+ *    array of `Bounded<size_t, 0, 255>` indices takes one byte per index,
+ *  - arithmetic with other `Bounded` or `Fixed` values computes the range of
+ *    the result at compile time; a result whose range is a single value is a
+ *    `Fixed`, a result that may overflow is a plain integer,
+ *  - comparisons decided by the ranges return a `Fixed<bool, ...>`, so the
+ *    bounds checks they express disappear at compile time,
+ *  - reading the value tells the optimiser its range.
+ *
+ * Example:
+ * @code
+ * const BIC::Bounded<int, 0, 15> lane(i & 15);
+ * const auto offset = lane * BIC::fixed<int, 4> + BIC::fixed<int, 1>; // BIC::Bounded<int, 1, 61>
+ * static_assert(BIC::IsFixed<decltype(offset < BIC::fixed<int, 64>)>::value); // always true, no check
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Mutable.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <exception> // for std::terminate
+#include <limits>
+#include <type_traits>
+#include <utility>   // for std::cmp_less, std::in_range
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/**
+ * @brief Smallest integer type holding every value of `[LO, HI]`, unsigned when `LO` is not negative.
+ */
+template<auto LO, auto HI>
+using BoundedStorage =
+	std::conditional_t<std::cmp_greater_equal(LO, 0),
+		std::conditional_t<std::in_range<std::uint8_t>(HI),  std::uint8_t,
+		std::conditional_t<std::in_range<std::uint16_t>(HI), std::uint16_t,
+		std::conditional_t<std::in_range<std::uint32_t>(HI), std::uint32_t, std::uint64_t>>>,
+		std::conditional_t<std::in_range<std::int8_t>(LO)  and std::in_range<std::int8_t>(HI),  std::int8_t,
+		std::conditional_t<std::in_range<std::int16_t>(LO) and std::in_range<std::int16_t>(HI), std::int16_t,
+		std::conditional_t<std::in_range<std::int32_t>(LO) and std::in_range<std::int32_t>(HI), std::int32_t, std::int64_t>>>>;
+
+/**
+ * @brief Tells the optimiser that the end of a path is never reached.
+ */
+[[noreturn]] inline void unreachable()
+{
+#if defined(__GNUC__)
+	__builtin_unreachable();
+#elif defined(_MSC_VER)
+	__assume(false);
+#else
+	std::terminate();
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @brief Runtime integer of type `T` whose value lies in `[LO, HI]`.
+ *
+ * @tparam T  Type of the value.
+ * @tparam LO Lowest possible value.
+ * @tparam HI Highest possible value.
+ */
+template<std::integral T, T LO, T HI>
+class Bounded
+{
+	static_assert(not std::same_as<T, bool>, "BIC::Bounded: bool is not a valid value type");
+	static_assert(LO <= HI, "BIC::Bounded: empty range");
+
+public:
+	using Type    = T;                                 ///< @brief Type of the value.
+	using Storage = detail::BoundedStorage<LO, HI>;   ///< @brief Type the value is stored as.
+
+	static constexpr Fixed<T, LO> lowest  = {}; ///< @brief Lowest possible value.
+	static constexpr Fixed<T, HI> highest = {}; ///< @brief Highest possible value.
+
+	/**
+	 * @brief Wraps `value`, which must lie in `[LO, HI]`; checked by an `assert` unless `NDEBUG` is defined.
+	 */
+	constexpr explicit Bounded(const T value) : storage_(static_cast<Storage>(value))
+	{
+		assert(std::cmp_less_equal(LO, value) and std::cmp_less_equal(value, HI) and "BIC::Bounded: value out of range");
+		if (std::cmp_less(value, LO) or std::cmp_greater(value, HI)) { detail::unreachable(); }
+	}
+
+	/**
+	 * @brief Wraps a `Fixed` within the range.
+	 */
+	template<std::integral U, U VALUE> requires (std::cmp_less_equal(LO, VALUE) and std::cmp_less_equal(VALUE, HI))
+	constexpr Bounded(const Fixed<U, VALUE>) : storage_(static_cast<Storage>(VALUE)) {}
+
+	/**
+	 * @brief Widens a `Bounded` whose range is included in this one.
+	 */
+	template<std::integral U, U OTHER_LO, U OTHER_HI> requires (std::cmp_less_equal(LO, OTHER_LO) and std::cmp_less_equal(OTHER_HI, HI))
+	constexpr Bounded(const Bounded<U, OTHER_LO, OTHER_HI> other) : storage_(static_cast<Storage>(other.value())) {}
+
+	/**
+	 * @brief Wraps `value` clamped to `[LO, HI]`.
+	 */
+	static constexpr Bounded clamp(const T value) { return Bounded(std::cmp_less(value, LO) ? LO : (std::cmp_greater(value, HI) ? HI : value)); }
+
+	/**
+	 * @brief The value, whose range is made known to the optimiser.
+	 */
+	constexpr T value() const
+	{
+		const T value = static_cast<T>(storage_);
+		assert(std::cmp_less_equal(LO, value) and std::cmp_less_equal(value, HI) and "BIC::Bounded: value out of range");
+		if (std::cmp_less(value, LO) or std::cmp_greater(value, HI)) { detail::unreachable(); }
+		return value;
+	}
+
+	constexpr operator T() const { return value(); } ///< @brief Implicit conversion to the value.
+
+private:
+	Storage storage_;
+};
+
+namespace detail
+{
+
+template<typename T, T LO, T HI>
+struct MutableTraits<Bounded<T, LO, HI>>
+{
+	using Type = T;
+};
+
+/**
+ * @brief Range of an operand of the `Bounded` arithmetic: a `Bounded` or an integral `Fixed`.
+ */
+template<typename X> struct BoundedTraits { static constexpr bool IS_BOUNDED = false; static constexpr bool IS_OPERAND = false; };
+
+template<typename T, T LO_, T HI_>
+struct BoundedTraits<Bounded<T, LO_, HI_>>
+{
+	static constexpr bool IS_BOUNDED = true;
+	static constexpr bool IS_OPERAND = true;
+
+	static constexpr T LO = LO_;
+	static constexpr T HI = HI_;
+};
+
+template<std::integral T, T VALUE> requires (not std::same_as<T, bool>)
+struct BoundedTraits<Fixed<T, VALUE>>
+{
+	static constexpr bool IS_BOUNDED = false;
+	static constexpr bool IS_OPERAND = true;
+
+	static constexpr T LO = VALUE;
+	static constexpr T HI = VALUE;
+};
+
+/// Two operands of the `Bounded` arithmetic, one of them at least being a `Bounded`.
+template<typename A, typename B>
+concept BoundedOperands = BoundedTraits<A>::IS_OPERAND and BoundedTraits<B>::IS_OPERAND and (BoundedTraits<A>::IS_BOUNDED or BoundedTraits<B>::IS_BOUNDED);
+
+/**
+ * @brief Range `[lo, hi]` of a result, `valid` being false when the result may overflow.
+ */
+template<typename R>
+struct BoundedRange
+{
+	R    lo    = 0;
+	R    hi    = 0;
+	bool valid = false;
+};
+
+template<typename R>
+constexpr bool checkedAdd(const R a, const R b, R& result)
+{
+	constexpr R MIN = std::numeric_limits<R>::min();
+	constexpr R MAX = std::numeric_limits<R>::max();
+
+	if (std::cmp_greater(b, 0) and a > MAX - b) { return false; }
+	if (std::cmp_less(b, 0)    and a < MIN - b) { return false; }
+	result = a + b;
+	return true;
+}
+
+template<typename R>
+constexpr bool checkedSubtract(const R a, const R b, R& result)
+{
+	constexpr R MIN = std::numeric_limits<R>::min();
+	constexpr R MAX = std::numeric_limits<R>::max();
+
+	if (std::cmp_less(b, 0)    and a > MAX + b) { return false; }
+	if (std::cmp_greater(b, 0) and a < MIN + b) { return false; }
+	result = a - b;
+	return true;
+}
+
+template<typename R>
+constexpr bool checkedMultiply(const R a, const R b, R& result)
+{
+	constexpr R MIN = std::numeric_limits<R>::min();
+	constexpr R MAX = std::numeric_limits<R>::max();
+
+	const bool aNegative = std::cmp_less(a, 0);
+	const bool bNegative = std::cmp_less(b, 0);
+
+	if (a != 0 and b != 0)
+	{
+		if (not aNegative and not bNegative and a > MAX / b) { return false; }
+		if (not aNegative and bNegative     and b < MIN / a) { return false; }
+		if (aNegative     and not bNegative and a < MIN / b) { return false; }
+		if (aNegative     and bNegative     and b < MAX / a) { return false; }
+	}
+	result = a * b;
+	return true;
+}
+
+template<typename R>
+constexpr bool checkedDivide(const R a, const R b, R& result)
+{
+	if (b == 0) { return false; }
+	if constexpr (std::is_signed_v<R>) { if (a == std::numeric_limits<R>::min() and b == R(-1)) { return false; } }
+	result = a / b;
+	return true;
+}
+
+/**
+ * @brief Range of `a op b` for `a` in the range of `A` and `b` in the range of `B`.
+ *
+ * Valid for the operations monotonic in each operand over the ranges, whose
+ * extrema are reached at the corners: `+`, `-`, `*`, and `/` by a range
+ * excluding zero.
+ */
+template<typename R, typename A, typename B, typename Op>
+constexpr BoundedRange<R> cornerRange(const Op op)
+{
+	using TA = BoundedTraits<A>;
+	using TB = BoundedTraits<B>;
+
+	if (not (std::in_range<R>(TA::LO) and std::in_range<R>(TA::HI) and std::in_range<R>(TB::LO) and std::in_range<R>(TB::HI))) { return {}; }
+
+	const R a[2] = {static_cast<R>(TA::LO), static_cast<R>(TA::HI)};
+	const R b[2] = {static_cast<R>(TB::LO), static_cast<R>(TB::HI)};
+
+	BoundedRange<R> range;
+	for (int i = 0; i != 4; ++i)
+	{
+		R corner = 0;
+		if (not op(a[i / 2], b[i % 2], corner)) { return {}; }
+		range.lo = i == 0 or corner < range.lo ? corner : range.lo;
+		range.hi = i == 0 or corner > range.hi ? corner : range.hi;
+	}
+	range.valid = true;
+	return range;
+}
+
+/**
+ * @brief Wraps a result of range `RANGE`: a `Fixed` for a single value, a `Bounded` otherwise, or `value` itself when it may overflow.
+ */
+template<typename R, BoundedRange<R> RANGE>
+constexpr auto makeBounded([[maybe_unused]] const R value)
+{
+	if constexpr (not RANGE.valid)            { return value; }
+	else if constexpr (RANGE.lo == RANGE.hi) { return Fixed<R, RANGE.lo>{}; }
+	else                                      { return Bounded<R, RANGE.lo, RANGE.hi>(value); }
+}
+
+template<typename A, typename B> using BoundedSumType        = decltype(std::declval<Mutable<A>>() + std::declval<Mutable<B>>());
+template<typename A, typename B> using BoundedDifferenceType = decltype(std::declval<Mutable<A>>() - std::declval<Mutable<B>>());
+template<typename A, typename B> using BoundedProductType    = decltype(std::declval<Mutable<A>>() * std::declval<Mutable<B>>());
+template<typename A, typename B> using BoundedQuotientType   = decltype(std::declval<Mutable<A>>() / std::declval<Mutable<B>>());
+
+template<typename B>
+constexpr bool rangeExcludesZero() { return std::cmp_greater(BoundedTraits<B>::LO, 0) or std::cmp_less(BoundedTraits<B>::HI, 0); }
+
+} // namespace detail
+
+// ============================================================================
+// Arithmetic operators for Bounded
+// ============================================================================
+
+/**
+ * @brief Arithmetic between `Bounded` and `Fixed` operands, the range of the result is computed at compile time.
+ *
+ * The value and its type are those of the built-in operator. The result is a
+ * `Bounded` of that type, a `Fixed` when the range is a single value, or a
+ * plain integer when the result may overflow.
+ */
+template<typename A, typename B> requires detail::BoundedOperands<A, B>
+constexpr auto operator+(const A a, const B b)
+{
+	using R = detail::BoundedSumType<A, B>;
+
+	constexpr auto RANGE = detail::cornerRange<R, A, B>(detail::checkedAdd<R>);
+	return detail::makeBounded<R, RANGE>(static_cast<R>(static_cast<R>(static_cast<Mutable<A>>(a)) + static_cast<R>(static_cast<Mutable<B>>(b))));
+}
+
+template<typename A, typename B> requires detail::BoundedOperands<A, B>
+constexpr auto operator-(const A a, const B b)
+{
+	using R = detail::BoundedDifferenceType<A, B>;
+
+	constexpr auto RANGE = detail::cornerRange<R, A, B>(detail::checkedSubtract<R>);
+	return detail::makeBounded<R, RANGE>(static_cast<R>(static_cast<R>(static_cast<Mutable<A>>(a)) - static_cast<R>(static_cast<Mutable<B>>(b))));
+}
+
+template<typename A, typename B> requires detail::BoundedOperands<A, B>
+constexpr auto operator*(const A a, const B b)
+{
+	using R = detail::BoundedProductType<A, B>;
+
+	constexpr auto RANGE = detail::cornerRange<R, A, B>(detail::checkedMultiply<R>);
+	return detail::makeBounded<R, RANGE>(static_cast<R>(static_cast<R>(static_cast<Mutable<A>>(a)) * static_cast<R>(static_cast<Mutable<B>>(b))));
+}
+
+/**
+ * @brief Division by a `Fixed` or a `Bounded` whose range excludes zero.
+ */
+template<typename A, typename B> requires detail::BoundedOperands<A, B> and (detail::rangeExcludesZero<B>())
+constexpr auto operator/(const A a, const B b)
+{
+	using R = detail::BoundedQuotientType<A, B>;
+
+	constexpr auto RANGE = detail::cornerRange<R, A, B>(detail::checkedDivide<R>);
+	return detail::makeBounded<R, RANGE>(static_cast<R>(static_cast<R>(static_cast<Mutable<A>>(a)) / static_cast<R>(static_cast<Mutable<B>>(b))));
+}
+
+/**
+ * @brief Remainder of a `Bounded` by a non-zero `Fixed`, of the sign of the dividend and lower than the divisor in magnitude.
+ */
+template<typename T, T LO, T HI, std::integral U, U VALUE> requires (VALUE != U(0))
+constexpr auto operator%(const Bounded<T, LO, HI> a, const Fixed<U, VALUE>)
+{
+	using R = decltype(std::declval<T>() % std::declval<U>());
+
+	constexpr auto RANGE = []
+	{
+		if (not (std::in_range<R>(LO) and std::in_range<R>(HI) and std::in_range<R>(VALUE))) { return detail::BoundedRange<R>{}; }
+
+		const R magnitude = std::cmp_less(VALUE, 0) ? static_cast<R>(R(0) - static_cast<R>(VALUE)) : static_cast<R>(VALUE);
+		const R lo        = static_cast<R>(LO);
+		const R hi        = static_cast<R>(HI);
+
+		// |a % c| < |c| and |a % c| <= |a|, with the sign of a
+		const R largest = magnitude - 1;
+		return detail::BoundedRange<R>{std::cmp_less(lo, 0) ? (lo > R(0) - largest ? lo : R(0) - largest) : R(0), std::cmp_greater(hi, 0) ? (hi < largest ? hi : largest) : R(0), true};
+	}();
+	return detail::makeBounded<R, RANGE>(static_cast<R>(static_cast<R>(a.value()) % static_cast<R>(VALUE)));
+}
+
+template<typename T, T LO, T HI>
+constexpr auto operator-(const Bounded<T, LO, HI> a)
+{
+	using R = decltype(-std::declval<T>());
+
+	return Fixed<R, R(0)>{} - a;
+}
+
+// ============================================================================
+// Comparison operators for Bounded
+// ============================================================================
+
+namespace detail
+{
+
+/**
+ * @brief `a < b`, a `Fixed<bool, ...>` when the ranges decide it, a `bool` otherwise.
+ *
+ * Values are compared mathematically, as `std::cmp_less`, whatever their signedness.
+ */
+template<typename A, typename B>
+constexpr auto boundedLess(const A a, const B b)
+{
+	using TA = BoundedTraits<A>;
+	using TB = BoundedTraits<B>;
+
+	if constexpr (std::cmp_less(TA::HI, TB::LO))              { return Fixed<bool, true>{}; }
+	else if constexpr (std::cmp_greater_equal(TA::LO, TB::HI)) { return Fixed<bool, false>{}; }
+	else                                                       { return std::cmp_less(static_cast<Mutable<A>>(a), static_cast<Mutable<B>>(b)); }
+}
+
+template<typename A, typename B>
+constexpr auto boundedEqual(const A a, const B b)
+{
+	using TA = BoundedTraits<A>;
+	using TB = BoundedTraits<B>;
+
+	if constexpr (std::cmp_less(TA::HI, TB::LO) or std::cmp_less(TB::HI, TA::LO)) { return Fixed<bool, false>{}; }
+	else                                                                           { return std::cmp_equal(static_cast<Mutable<A>>(a), static_cast<Mutable<B>>(b)); }
+}
+
+} // namespace detail
+
+template<typename A, typename B> requires detail::BoundedOperands<A, B>
+constexpr auto operator<(const A a, const B b) { return detail::boundedLess(a, b); }
+
+template<typename A, typename B> requires detail::BoundedOperands<A, B>
+constexpr auto operator>(const A a, const B b) { return detail::boundedLess(b, a); }
+
+template<typename A, typename B> requires detail::BoundedOperands<A, B>
+constexpr auto operator<=(const A a, const B b) { return not detail::boundedLess(b, a); }
+
+template<typename A, typename B> requires detail::BoundedOperands<A, B>
+constexpr auto operator>=(const A a, const B b) { return not detail::boundedLess(a, b); }
+
+template<typename A, typename B> requires detail::BoundedOperands<A, B>
+constexpr auto operator==(const A a, const B b) { return detail::boundedEqual(a, b); }
+
+template<typename A, typename B> requires detail::BoundedOperands<A, B>
+constexpr auto operator!=(const A a, const B b) { return not detail::boundedEqual(a, b); }
+
+} // namespace BIC
+
+#endif // BIC_BOUNDED_HPP
@@ -1,8 +1,25 @@
+#include <BIC/Algorithms.hpp>
 #include <BIC/Reversed.hpp>
+#include <BIC/Bounded.hpp>
+#include <BIC/Dispatch.hpp>
+#include <BIC/Divisor.hpp>
 #include <BIC/FixedArray.hpp>
+#include <BIC/FixedBuffer.hpp>
+#include <BIC/FixedMap.hpp>
+#include <BIC/FixedSpan.hpp>
 #include <BIC/Fixed.hpp>
 #include <BIC/Formater.hpp>
+#include <BIC/Integer.hpp>
 #include <BIC/IsFixed.hpp>
 #include <BIC/Loops.hpp>
+#include <BIC/LoopsND.hpp>
+#include <BIC/Memory.hpp>
 #include <BIC/Mutable.hpp>
+#include <BIC/Polynomial.hpp>
 #include <BIC/Seq.hpp>
+#include <BIC/Shape.hpp>
+#include <BIC/Sort.hpp>
+#include <BIC/Stencil.hpp>
+#include <BIC/Stored.hpp>
+#include <BIC/Tabulate.hpp>
+#include <BIC/Tuple.hpp>
@@ -0,0 +1,417 @@
+#ifndef BIC_DISPATCH_HPP
+#define BIC_DISPATCH_HPP
+
+/**
+ * @file Dispatch.hpp
+ * @brief Runtime-to-Fixed dispatch over a compile-time set of candidates.
+ * @date 2025
+ * @version 1.0
+ *
+ * `BIC::dispatch` turns a runtime value into the matching `BIC::Fixed` taken
+ * from a `FixedArray` of candidates, so that a single specialised kernel can
+ * serve every hot call without a hand-written `switch`.
+ *
+ * Dense integral candidate sets are lowered to a jump table indexed by
+ * `value - min`, sparse (or non-integral) ones to a balanced branch tree over
+ * the sorted candidates. When no candidate matches, a generic fallback is
+ * called with the runtime value.
+ *
+ * Example:
+ * @code
+ * const size_t n = readSizeFromConfig();
+ * BIC::dispatch(n, BIC::seq<size_t, 1, 17>, [&](const auto N)
+ * {
+ *     axpy(alpha, x, N, y); // N is a Fixed<size_t, n> when 1 <= n < 17, size_t otherwise
+ * });
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedArray.hpp>
+
+#include <algorithm> // for std::lower_bound
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/**
+ * @brief Compile-time properties of a candidate set used to pick a dispatch strategy.
+ *
+ * @tparam T      Scalar type of the candidates.
+ * @tparam VALUES Candidate values.
+ */
+template<typename T, T... VALUES>
+struct DispatchTraits
+{
+	static constexpr size_t SIZE = sizeof...(VALUES);
+
+	static constexpr const std::array<T, SIZE>& SORTED = SortedValues<T, VALUES...>::values;
+
+	static constexpr size_t JUMP_TABLE_MIN_SIZE    = 4;    ///< @brief Below this many candidates a branch tree is always cheaper.
+	static constexpr size_t JUMP_TABLE_MAX_SPAN    = 1024; ///< @brief Upper bound on the number of jump table entries.
+	static constexpr size_t JUMP_TABLE_MAX_DENSITY = 4;    ///< @brief Maximum number of table entries per candidate.
+
+	static constexpr bool DENSE = []
+	{
+		if constexpr (std::integral<T> and not std::same_as<T, bool> and SIZE >= JUMP_TABLE_MIN_SIZE)
+		{
+			using Unsigned = std::make_unsigned_t<T>;
+
+			const Unsigned span = static_cast<Unsigned>(static_cast<Unsigned>(SORTED.back()) - static_cast<Unsigned>(SORTED.front()));
+
+			return span < JUMP_TABLE_MAX_SPAN and span < JUMP_TABLE_MAX_DENSITY*SIZE;
+		}
+		else
+		{
+			return false;
+		}
+	}();
+};
+
+template<typename Func, typename Fallback, typename T, T... VALUES>
+using DispatchResult = std::common_type_t<std::invoke_result_t<Func&, Fixed<T, VALUES>>..., std::invoke_result_t<Fallback&, T>>;
+
+/**
+ * @brief Jump table dispatch for dense integral candidate sets.
+ *
+ * The table holds one function pointer per value in `[min, max]`; holes point
+ * to the fallback. Lookup is a single subtraction, one unsigned bound check
+ * and one indirect call.
+ */
+template<typename Result, typename Func, typename Fallback, typename T, T... VALUES>
+struct JumpTableDispatcher
+{
+	using Traits   = DispatchTraits<T, VALUES...>;
+	using Unsigned = std::make_unsigned_t<T>;
+	using Entry    = Result(*)(Func&, Fallback&, T);
+
+	static constexpr T      MIN  = Traits::SORTED.front();
+	static constexpr size_t SPAN = static_cast<size_t>(static_cast<Unsigned>(static_cast<Unsigned>(Traits::SORTED.back()) - static_cast<Unsigned>(MIN))) + 1;
+
+	static constexpr size_t slot(const T value) { return static_cast<size_t>(static_cast<Unsigned>(static_cast<Unsigned>(value) - static_cast<Unsigned>(MIN))); }
+
+	template<T VALUE>
+	static constexpr Result callFunc(Func& func, Fallback&, const T) { return func(fixed<T, VALUE>); }
+
+	static constexpr Result callFallback(Func&, Fallback& fallback, const T value) { return fallback(value); }
+
+	static constexpr std::array<Entry, SPAN> TABLE = []
+	{
+		std::array<Entry, SPAN> table = {};
+		table.fill(&callFallback);
+		((table[slot(VALUES)] = &callFunc<VALUES>), ...);
+		return table;
+	}();
+
+	static constexpr Result run(Func& func, Fallback& fallback, const T value)
+	{
+		const size_t i = slot(value);
+		return i < SPAN ? TABLE[i](func, fallback, value) : callFallback(func, fallback, value);
+	}
+};
+
+/**
+ * @brief Branch tree dispatch for sparse or non-integral candidate sets.
+ *
+ * Performs a binary search over the sorted candidates, unrolled at compile
+ * time, so that each leaf compares against a single constant.
+ */
+template<typename Result, typename Func, typename Fallback, typename T, T... VALUES>
+struct BranchTreeDispatcher
+{
+	using Traits = DispatchTraits<T, VALUES...>;
+
+	template<size_t LO, size_t HI>
+	static constexpr Result search(Func& func, Fallback& fallback, const T value)
+	{
+		if constexpr (HI - LO == 1)
+		{
+			constexpr T CANDIDATE = Traits::SORTED[LO];
+
+			if (value == CANDIDATE) { return func(fixed<T, CANDIDATE>); }
+			return fallback(value);
+		}
+		else
+		{
+			constexpr size_t MID = LO + (HI - LO)/2;
+
+			if (value < Traits::SORTED[MID]) { return search<LO, MID>(func, fallback, value); }
+			return search<MID, HI>(func, fallback, value);
+		}
+	}
+
+	static constexpr Result run(Func& func, Fallback& fallback, const T value)
+	{
+		if constexpr (Traits::SIZE == 0) { return fallback(value); }
+		else                             { return search<0, Traits::SIZE>(func, fallback, value); }
+	}
+};
+
+/**
+ * @brief Lookup table from `value - min` to the position of `value` among the sorted candidates of a dense set.
+ */
+template<typename T, T... VALUES>
+struct DenseDispatchIndex
+{
+	using Traits   = DispatchTraits<T, VALUES...>;
+	using Unsigned = std::make_unsigned_t<T>;
+
+	static constexpr T      MIN  = Traits::SORTED.front();
+	static constexpr size_t SPAN = static_cast<size_t>(static_cast<Unsigned>(static_cast<Unsigned>(Traits::SORTED.back()) - static_cast<Unsigned>(MIN))) + 1;
+
+	static constexpr size_t slot(const T value) { return static_cast<size_t>(static_cast<Unsigned>(static_cast<Unsigned>(value) - static_cast<Unsigned>(MIN))); }
+
+	static constexpr std::array<unsigned short, SPAN> TABLE = []
+	{
+		std::array<unsigned short, SPAN> table = {};
+		table.fill(static_cast<unsigned short>(Traits::SIZE));
+		for (size_t i = Traits::SIZE; i-- > 0;) { table[slot(Traits::SORTED[i])] = static_cast<unsigned short>(i); }
+		return table;
+	}();
+
+	static constexpr size_t run(const T value)
+	{
+		const size_t i = slot(value);
+		return i < SPAN ? TABLE[i] : Traits::SIZE;
+	}
+};
+
+/**
+ * @brief Position of a runtime value among the sorted candidates, `SIZE` when it is not a candidate.
+ *
+ * Dense sets use a lookup table indexed by `value - min`, sparse ones a binary search.
+ */
+template<typename T, T... VALUES>
+struct DispatchIndex
+{
+	using Traits = DispatchTraits<T, VALUES...>;
+
+	static constexpr size_t run(const T value)
+	{
+		if constexpr (Traits::DENSE)
+		{
+			return DenseDispatchIndex<T, VALUES...>::run(value);
+		}
+		else
+		{
+			const auto it = std::lower_bound(Traits::SORTED.begin(), Traits::SORTED.end(), value);
+			return (it != Traits::SORTED.end() and *it == value) ? static_cast<size_t>(it - Traits::SORTED.begin()) : Traits::SIZE;
+		}
+	}
+};
+
+template<typename Candidates> struct CandidatesTraits;
+
+template<typename T, T... VALUES>
+struct CandidatesTraits<FixedArray<T, VALUES...>>
+{
+	using Scalar = T;
+	using Traits = DispatchTraits<T, VALUES...>;
+	using Index  = DispatchIndex<T, VALUES...>;
+};
+
+/**
+ * @brief Flat dispatch table over the cartesian product of several candidate sets.
+ *
+ * Dimensions are kept `Fixed` greedily, in argument order, as long as the
+ * product of their candidate counts stays within `MAX_INSTANTIATIONS`. The
+ * other dimensions are demoted and forwarded as runtime `Mutable` values.
+ * Each kept runtime value is mapped to its candidate position, the positions
+ * are linearised (row-major) and a single indirect call through the table
+ * reaches the specialised instantiation.
+ */
+template<size_t MAX_INSTANTIATIONS, typename Func, typename Fallback, typename Dims, typename... Candidates> struct CartesianDispatcher;
+
+template<size_t MAX_INSTANTIATIONS, typename Func, typename Fallback, size_t... Ds, typename... Candidates>
+struct CartesianDispatcher<MAX_INSTANTIATIONS, Func, Fallback, std::index_sequence<Ds...>, Candidates...>
+{
+	static constexpr size_t RANK = sizeof...(Candidates);
+
+	using Values = std::tuple<typename CandidatesTraits<Candidates>::Scalar...>;
+
+	static constexpr std::array<size_t, RANK> SIZES = {CandidatesTraits<Candidates>::Traits::SIZE...};
+
+	static constexpr std::array<bool, RANK> KEPT = []
+	{
+		std::array<bool, RANK> kept = {};
+		size_t total = 1;
+		for (size_t d = 0; d != RANK; ++d)
+		{
+			kept[d] = total*SIZES[d] <= MAX_INSTANTIATIONS;
+			if (kept[d]) { total *= SIZES[d]; }
+		}
+		return kept;
+	}();
+
+	static constexpr std::array<size_t, RANK> STRIDES = []
+	{
+		std::array<size_t, RANK> strides = {};
+		size_t stride = 1;
+		for (size_t d = RANK; d-- > 0;)
+		{
+			strides[d] = stride;
+			if (KEPT[d]) { stride *= SIZES[d]; }
+		}
+		return strides;
+	}();
+
+	static constexpr size_t TOTAL = []
+	{
+		size_t total = 1;
+		for (size_t d = 0; d != RANK; ++d) { if (KEPT[d]) { total *= SIZES[d]; } }
+		return total;
+	}();
+
+	template<size_t D, size_t L>
+	static constexpr decltype(auto) argument(const Values& values)
+	{
+		if constexpr (KEPT[D])
+		{
+			using Scalar = std::tuple_element_t<D, Values>;
+			using Traits = typename CandidatesTraits<std::tuple_element_t<D, std::tuple<Candidates...>>>::Traits;
+
+			return fixed<Scalar, Traits::SORTED[(L/STRIDES[D]) % SIZES[D]]>;
+		}
+		else
+		{
+			return std::get<D>(values);
+		}
+	}
+
+	template<size_t L>
+	using CallResult = std::invoke_result_t<Func&, decltype(argument<Ds, L>(std::declval<const Values&>()))...>;
+
+	template<typename Ls> struct Table;
+
+	template<size_t... Ls>
+	struct Table<std::index_sequence<Ls...>>
+	{
+		using Result = std::common_type_t<CallResult<Ls>..., std::invoke_result_t<Fallback&, typename CandidatesTraits<Candidates>::Scalar...>>;
+		using Entry  = Result(*)(Func&, const Values&);
+
+		template<size_t L>
+		static constexpr Result call(Func& func, const Values& values) { return func(argument<Ds, L>(values)...); }
+
+		static constexpr std::array<Entry, TOTAL> ENTRIES = {&call<Ls>...};
+	};
+
+	using Entries = Table<std::make_index_sequence<TOTAL>>;
+	using Result  = typename Entries::Result;
+
+	static constexpr Result run(Func& func, Fallback& fallback, const Values& values)
+	{
+		size_t linear = 0;
+		bool   found  = true;
+
+		([&]
+		{
+			if constexpr (KEPT[Ds])
+			{
+				using Index = typename CandidatesTraits<std::tuple_element_t<Ds, std::tuple<Candidates...>>>::Index;
+
+				const size_t i = Index::run(std::get<Ds>(values));
+				found   = found and i != SIZES[Ds];
+				linear += i*STRIDES[Ds];
+			}
+		}(), ...);
+
+		if (found) { return Entries::ENTRIES[linear](func, values); }
+		return std::apply(fallback, values);
+	}
+};
+
+inline constexpr size_t DISPATCH_DEFAULT_MAX_INSTANTIATIONS = 256; ///< @brief Default instantiation budget of the cartesian dispatch.
+
+} // namespace detail
+
+/**
+ * @brief Call `func` with the `Fixed` candidate equal to `value`, or `fallback` with `value` when there is none.
+ *
+ * @tparam T      Scalar type of the candidates.
+ * @tparam VALUES Candidate values.
+ *
+ * @param value      Runtime value to dispatch on.
+ * @param candidates FixedArray (e.g. a `BIC::seq`) of the values worth specialising for.
+ * @param func       Callable invoked as `func(BIC::fixed<T, V>)` when `value == V`.
+ * @param fallback   Callable invoked as `fallback(value)` when no candidate matches.
+ * @return The common type of every possible call.
+ */
+template<std::totally_ordered T, T... VALUES, typename Func, typename Fallback>
+constexpr detail::DispatchResult<std::remove_reference_t<Func>, std::remove_reference_t<Fallback>, T, VALUES...> dispatch(const std::type_identity_t<T> value, const FixedArray<T, VALUES...> /* candidates */, Func&& func, Fallback&& fallback)
+{
+	using FuncType     = std::remove_reference_t<Func>;
+	using FallbackType = std::remove_reference_t<Fallback>;
+	using Result       = detail::DispatchResult<FuncType, FallbackType, T, VALUES...>;
+
+	if constexpr (detail::DispatchTraits<T, VALUES...>::DENSE)
+	{
+		return detail::JumpTableDispatcher<Result, FuncType, FallbackType, T, VALUES...>::run(func, fallback, value);
+	}
+	else
+	{
+		return detail::BranchTreeDispatcher<Result, FuncType, FallbackType, T, VALUES...>::run(func, fallback, value);
+	}
+}
+
+/**
+ * @brief Call `func` with the `Fixed` candidate equal to `value`, or with `value` itself when there is none.
+ *
+ * Convenience overload for generic kernels that accept both `Fixed` and
+ * runtime arguments, the kernel is its own fallback.
+ */
+template<std::totally_ordered T, T... VALUES, typename Func>
+constexpr detail::DispatchResult<std::remove_reference_t<Func>, std::remove_reference_t<Func>, T, VALUES...> dispatch(const std::type_identity_t<T> value, const FixedArray<T, VALUES...> candidates, Func&& func)
+{
+	return dispatch(value, candidates, func, func);
+}
+
+/**
+ * @brief Dispatch several runtime values at once over the cartesian product of their candidates.
+ *
+ * @tparam MAX_INSTANTIATIONS Upper bound on the number of specialisations of `func`.
+ *
+ * @param values     Tuple of runtime values, one per dimension.
+ * @param candidates Tuple of FixedArray, one per dimension.
+ * @param func       Callable invoked with one argument per dimension.
+ * @param fallback   Callable invoked with the runtime values when a kept dimension has no matching candidate.
+ *
+ * Dimensions are specialised greedily in argument order while the product of
+ * the candidate counts stays within `MAX_INSTANTIATIONS`; the remaining
+ * dimensions are passed to `func` as runtime `Mutable` values. The whole
+ * product is served by a single flat table, not by nested dispatches.
+ *
+ * Example:
+ * @code
+ * BIC::dispatch<64>(std::tuple{m, n, unroll}, std::tuple{BIC::seq<size_t,1,9>, BIC::seq<size_t,1,9>, BIC::fixedArray<size_t,1,2,4,8>}, 
+ *     [&](const auto M, const auto N, const auto U) { gemm(M, N, U, a, b, c); });  // U is demoted to size_t
+ * @endcode
+ */
+template<size_t MAX_INSTANTIATIONS = detail::DISPATCH_DEFAULT_MAX_INSTANTIATIONS, typename... Ts, typename... Candidates, typename Func, typename Fallback> requires(sizeof...(Ts) == sizeof...(Candidates))
+constexpr decltype(auto) dispatch(const std::tuple<Ts...>& values, const std::tuple<Candidates...> /* candidates */, Func&& func, Fallback&& fallback)
+{
+	using Dispatcher = detail::CartesianDispatcher<MAX_INSTANTIATIONS, std::remove_reference_t<Func>, std::remove_reference_t<Fallback>, std::index_sequence_for<Candidates...>, Candidates...>;
+
+	return Dispatcher::run(func, fallback, typename Dispatcher::Values(values));
+}
+
+/**
+ * @brief Dispatch several runtime values at once, `func` being its own fallback.
+ */
+template<size_t MAX_INSTANTIATIONS = detail::DISPATCH_DEFAULT_MAX_INSTANTIATIONS, typename... Ts, typename... Candidates, typename Func> requires(sizeof...(Ts) == sizeof...(Candidates))
+constexpr decltype(auto) dispatch(const std::tuple<Ts...>& values, const std::tuple<Candidates...> candidates, Func&& func)
+{
+	return dispatch<MAX_INSTANTIATIONS>(values, candidates, func, func);
+}
+
+} // namespace BIC
+
+#endif // BIC_DISPATCH_HPP
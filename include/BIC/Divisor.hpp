@@ -0,0 +1,303 @@
+#ifndef BIC_DIVISOR_HPP
+#define BIC_DIVISOR_HPP
+
+/**
+ * @file Divisor.hpp
+ * @brief Division by a runtime invariant through precomputed multiply-shift magic numbers.
+ * @date 2025
+ * @version 1.0
+ *
+ * A hardware division costs tens of cycles. When the same runtime divisor is
+ * used many times, e.g. a tensor dimension while unflattening indices,
+ * `BIC::RuntimeDivisor` computes once the magic multiplier and shift of
+ * Granlund and Montgomery (as in libdivide), after which `n / d` is a high
+ * multiplication, an optional add and a shift, and `n % d` one more
+ * multiplication and subtraction.
+ *
+ * `BIC::Divisor<T>` is `RuntimeDivisor<T>` for an integer type and `T`
+ * itself for a `Fixed`, whose division the compiler already optimises, so
+ * generic code can be written once with `/` and `%`:
+ * @code
+ * template<typename Columns>
+ * void unflatten(const size_t index, const Columns columns, size_t& row, size_t& column)
+ * {
+ *     row    = index / columns;
+ *     column = index % columns;
+ * }
+ *
+ * const BIC::Divisor<size_t> columns = BIC::divisor(n);  // magic numbers computed once
+ * for (size_t i = 0; i != size; ++i) { unflatten(i, columns, row, column); }
+ * unflatten(i, BIC::fixed<size_t, 8>, row, column);      // plain shift and mask
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Mutable.hpp>
+
+#include <bit>         // for std::bit_width
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/// Unsigned integer used for the computations: 32 bits for the types up to 32 bits, 64 bits otherwise.
+template<std::integral T>
+using DivisorWord = std::conditional_t<(sizeof(T) <= sizeof(std::uint32_t)), std::uint32_t, std::uint64_t>;
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 DivisorWideWord; ///< 128-bit integer of GCC and Clang, `__extension__` silences -Wpedantic.
+#endif
+
+/**
+ * @brief High half of the product of two unsigned words.
+ */
+template<std::unsigned_integral W>
+constexpr W multiplyHigh(const W a, const W b)
+{
+	if constexpr (sizeof(W) == sizeof(std::uint32_t)) { return static_cast<W>((std::uint64_t(a) * b) >> 32); }
+#ifdef __SIZEOF_INT128__
+	else { return static_cast<W>((static_cast<DivisorWideWord>(a) * b) >> 64); }
+#else
+	else
+	{
+		const W aLow  = a & 0xFFFFFFFF, aHigh = a >> 32;
+		const W bLow  = b & 0xFFFFFFFF, bHigh = b >> 32;
+		const W lowLow   = aLow * bLow;
+		const W lowHigh  = aLow * bHigh;
+		const W highLow  = aHigh * bLow;
+		const W middle   = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+		return aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+	}
+#endif
+}
+
+/**
+ * @brief High half of the product of two signed words, given as their two's complement bits.
+ */
+template<std::unsigned_integral W>
+constexpr W multiplyHighSigned(const W a, const W b)
+{
+	constexpr W SIGN = W(1) << (8*sizeof(W) - 1);
+
+	W high = multiplyHigh(a, b);
+	if (a & SIGN) { high -= b; }
+	if (b & SIGN) { high -= a; }
+	return high;
+}
+
+/**
+ * @brief `(high * 2^N + low) / d` for `high < d`, `N` being the width of `W`, and its remainder.
+ *
+ * Bitwise long division: it only runs when a divisor is built.
+ */
+template<std::unsigned_integral W>
+constexpr W divideWide(W high, const W low, const W d, W& remainder)
+{
+	constexpr int BITS = 8*sizeof(W);
+
+	W quotient = 0;
+	for (int i = BITS - 1; i >= 0; --i)
+	{
+		const bool carry = (high >> (BITS - 1)) != 0;
+		high     = (high << 1) | ((low >> i) & 1);
+		quotient = quotient << 1;
+		if (carry or high >= d) { high -= d; quotient |= 1; }
+	}
+	remainder = high;
+	return quotient;
+}
+
+} // namespace detail
+
+/**
+ * @brief Runtime divisor with precomputed magic numbers, built once and used for many divisions.
+ *
+ * @tparam T Integer type of the divisor, of the numerators and of the results.
+ *
+ * The quotient and the remainder are exactly those of the built-in `/` and
+ * `%` (truncated towards zero), with the same preconditions: the divisor is
+ * not zero and, for signed types, the division does not overflow.
+ */
+template<std::integral T>
+class RuntimeDivisor
+{
+	static_assert(not std::same_as<T, bool>, "BIC::RuntimeDivisor: bool is not a valid divisor type");
+
+	using Word = detail::DivisorWord<T>;
+
+	static constexpr int BITS = 8*sizeof(Word);
+
+	T             divisor_;
+	Word          magic_    = 0;     ///< Magic multiplier, 0 when the divisor is a power of two (or its opposite).
+	unsigned char shift_    = 0;     ///< Final shift.
+	bool          add_      = false; ///< The magic multiplier needs one more bit: the numerator is added back.
+	bool          negative_ = false; ///< Signed divisor lower than zero.
+
+public:
+	using Type = T; ///< @brief Type of the divisor.
+
+	/**
+	 * @brief Computes the magic numbers of `d`, which must not be zero.
+	 */
+	constexpr RuntimeDivisor(const T d) : divisor_(d)
+	{
+		if constexpr (std::is_unsigned_v<T>)
+		{
+			const Word absolute = static_cast<Word>(d);
+			const int  log      = static_cast<int>(std::bit_width(absolute)) - 1;
+
+			shift_ = static_cast<unsigned char>(log);
+			if ((absolute & (absolute - 1)) == 0) { return; }
+
+			Word remainder = 0;
+			Word magic     = detail::divideWide(Word(1) << log, Word(0), absolute, remainder);
+			if (absolute - remainder >= (Word(1) << log))
+			{
+				// 2^(BITS + log) / d rounded up does not fit in a word, the extra bit is added back after the multiplication
+				const Word twiceRemainder = remainder + remainder;
+				magic += magic;
+				if (twiceRemainder >= absolute or twiceRemainder < remainder) { magic += 1; }
+				add_ = true;
+			}
+			magic_ = magic + 1;
+		}
+		else
+		{
+			negative_ = d < 0;
+
+			const Word absolute = negative_ ? Word(0) - static_cast<Word>(d) : static_cast<Word>(d);
+			const int  log      = static_cast<int>(std::bit_width(absolute)) - 1;
+
+			shift_ = static_cast<unsigned char>(log);
+			if ((absolute & (absolute - 1)) == 0) { return; }
+
+			Word remainder = 0;
+			Word magic     = detail::divideWide(Word(1) << (log - 1), Word(0), absolute, remainder);
+			if (absolute - remainder < (Word(1) << log)) { shift_ = static_cast<unsigned char>(log - 1); }
+			else
+			{
+				const Word twiceRemainder = remainder + remainder;
+				magic += magic;
+				if (twiceRemainder >= absolute or twiceRemainder < remainder) { magic += 1; }
+				add_ = true;
+			}
+			magic += 1;
+			magic_ = negative_ ? Word(0) - magic : magic;
+		}
+	}
+
+	constexpr T value() const { return divisor_; } ///< @brief The divisor.
+
+	constexpr operator T() const { return divisor_; } ///< @brief Implicit conversion to the divisor.
+
+	/**
+	 * @brief `n / divisor`, truncated towards zero.
+	 */
+	constexpr T divide(const T n) const
+	{
+		if constexpr (std::is_unsigned_v<T>)
+		{
+			const Word numerator = static_cast<Word>(n);
+			if (magic_ == 0) { return static_cast<T>(numerator >> shift_); }
+
+			const Word high = detail::multiplyHigh(magic_, numerator);
+			if (add_) { return static_cast<T>((((numerator - high) >> 1) + high) >> shift_); }
+			else      { return static_cast<T>(high >> shift_); }
+		}
+		else
+		{
+			using Signed = std::make_signed_t<Word>;
+
+			// Sign extension to the word, then all the arithmetic on unsigned words to avoid overflows
+			const Word numerator = static_cast<Word>(static_cast<Signed>(n));
+			const Word sign      = negative_ ? ~Word(0) : Word(0);
+
+			if (magic_ == 0)
+			{
+				// Power of two: round towards zero by adding divisor - 1 to negative numerators
+				const Word mask    = (Word(1) << shift_) - 1;
+				const Word rounded = numerator + ((numerator >> (BITS - 1)) ? mask : Word(0));
+				return static_cast<T>(((static_cast<Signed>(rounded) >> shift_) ^ static_cast<Signed>(sign)) - static_cast<Signed>(sign));
+			}
+
+			Word high = detail::multiplyHighSigned(magic_, numerator);
+			if (add_) { high += (numerator ^ sign) - sign; }
+
+			const Signed quotient = static_cast<Signed>(high) >> shift_;
+			return static_cast<T>(quotient + (quotient < 0 ? 1 : 0));
+		}
+	}
+
+	/**
+	 * @brief `n % divisor`, of the sign of `n`.
+	 */
+	constexpr T remainder(const T n) const
+	{
+		return static_cast<T>(n - divide(n)*divisor_);
+	}
+};
+
+namespace detail
+{
+
+template<typename T>
+struct DivisorTraits
+{
+	using Type = RuntimeDivisor<T>;
+};
+
+template<typename T, T VALUE>
+struct DivisorTraits<Fixed<T, VALUE>>
+{
+	static_assert(VALUE != T(0), "BIC::Divisor: division by zero");
+
+	using Type = Fixed<T, VALUE>;
+};
+
+template<typename T>
+struct DivisorTraits<RuntimeDivisor<T>>
+{
+	using Type = RuntimeDivisor<T>;
+};
+
+template<typename T>
+struct MutableTraits<RuntimeDivisor<T>>
+{
+	using Type = T;
+};
+
+} // namespace detail
+
+/**
+ * @brief Divisor of type `T`: a `RuntimeDivisor<T>` for an integer type, `T` itself for a `Fixed`.
+ */
+template<typename T>
+using Divisor = typename detail::DivisorTraits<T>::Type;
+
+/**
+ * @brief Makes the divisor of `d`: the same `Fixed` for a `Fixed`, a `RuntimeDivisor` otherwise.
+ */
+template<typename T> requires std::integral<Mutable<T>>
+constexpr Divisor<T> divisor(const T d) { return Divisor<T>(d); }
+
+/**
+ * @brief `n / d`, with the result type of `d`.
+ */
+template<typename N, std::integral T> requires std::integral<Mutable<N>>
+constexpr T operator/(const N n, const RuntimeDivisor<T>& d) { return d.divide(static_cast<T>(n)); }
+
+/**
+ * @brief `n % d`, with the result type of `d`.
+ */
+template<typename N, std::integral T> requires std::integral<Mutable<N>>
+constexpr T operator%(const N n, const RuntimeDivisor<T>& d) { return d.remainder(static_cast<T>(n)); }
+
+} // namespace BIC
+
+#endif // BIC_DIVISOR_HPP
@@ -4,6 +4,24 @@
 #include <BIC/misc/ComparableTo.hpp>
 #include <type_traits> // for std::common_type_t
 #include <concepts>
+#include <limits>      // for std::numeric_limits
+#include <utility>     // for std::declval
+
+/**
+ * @brief When non-zero, mixed `Fixed`/runtime operators also apply the algebraic identities that are not IEEE-safe.
+ *
+ * Defaults to 1 when compiling with `-ffast-math` and to 0 otherwise. The
+ * unsafe identities are `x + 0 -> x` and `0 - x -> -x` (wrong sign for
+ * zeros), `x * 0 -> 0` (wrong for NaN, infinities and negative values) and
+ * `x / c -> x * (1/c)` (rounding) on floating-point values.
+ */
+#ifndef BIC_FAST_MATH
+	#ifdef __FAST_MATH__
+		#define BIC_FAST_MATH 1
+	#else
+		#define BIC_FAST_MATH 0
+	#endif
+#endif
  
 namespace BIC
 {
@@ -70,6 +88,292 @@ constexpr Fixed<std::common_type_t<Lhs, Rhs>, lhs / rhs> operator/(const Fixed<L
 template<typename T, T value>
 constexpr Fixed<T, -value> operator-(const Fixed<T, value>) { return {}; }
 
+// ============================================================================
+// Arithmetic operators between a Fixed and a runtime value
+// ============================================================================
+
+namespace detail
+{
+
+inline constexpr bool FAST_MATH = BIC_FAST_MATH != 0;
+
+template<typename Lhs, typename Rhs> using SumType        = decltype(std::declval<Lhs>() + std::declval<Rhs>());
+template<typename Lhs, typename Rhs> using DifferenceType = decltype(std::declval<Lhs>() - std::declval<Rhs>());
+template<typename Lhs, typename Rhs> using ProductType    = decltype(std::declval<Lhs>() * std::declval<Rhs>());
+template<typename Lhs, typename Rhs> using QuotientType   = decltype(std::declval<Lhs>() / std::declval<Rhs>());
+
+/// Floating-point zeros are distinct template arguments, `-0.` is the only zero that `x + 0` may drop safely.
+template<typename T, T VALUE> inline constexpr bool IS_NEGATIVE_ZERO = std::floating_point<T> and std::is_same_v<Fixed<T, VALUE>, Fixed<T, -T(0)>>;
+
+/// Whether a floating-point value is neither infinite nor NaN; `std::isfinite` is not constexpr.
+template<std::floating_point T>
+constexpr bool isFinite(const T value) { return value >= std::numeric_limits<T>::lowest() and value <= std::numeric_limits<T>::max(); }
+
+/// Whether `1 / value` is finite, which is not the case of zero and of the smallest (subnormal) values.
+template<std::floating_point T>
+constexpr bool hasFiniteReciprocal(const T value) { return isFinite(value) and (value < T(0) ? -value : value) > T(1) / std::numeric_limits<T>::max(); }
+
+template<typename T>
+constexpr bool isPowerOfTwo(T value)
+{
+	if (not (value > T(0))) { return false; }
+	if constexpr (std::floating_point<T>)
+	{
+		if (not isFinite(value)) { return false; }
+
+		// Scaling by 2 is exact, so the loop ends on 1 exactly for powers of two
+		while (value >= T(2)) { value /= T(2); }
+		while (value <  T(1)) { value *= T(2); }
+		return value == T(1);
+	}
+	else { return (value & (value - 1)) == 0; }
+}
+
+template<typename T>
+constexpr int log2(T value)
+{
+	int n = 0;
+	while (value > T(1)) { value /= T(2); ++n; }
+	return n;
+}
+
+template<typename T, T VALUE, typename U>
+constexpr auto fixedPlus(const U x)
+{
+	using R = SumType<T, U>;
+
+	if constexpr (VALUE == T(0) and (std::integral<R> or IS_NEGATIVE_ZERO<T, VALUE> or FAST_MATH)) { return static_cast<R>(x); }
+	else                                                                                           { return static_cast<R>(static_cast<R>(x) + static_cast<R>(VALUE)); }
+}
+
+template<typename T, T VALUE, typename U>
+constexpr auto fixedTimes(const U x)
+{
+	using R = ProductType<T, U>;
+
+	if constexpr (VALUE == T(1))                                          { return static_cast<R>(x); }
+	else if constexpr (std::is_signed_v<T> and VALUE == T(-1))            { return static_cast<R>(-static_cast<R>(x)); }
+	else if constexpr (VALUE == T(0) and (std::integral<R> or FAST_MATH)) { return Fixed<R, R(0)>{}; }
+	else                                                                  { return static_cast<R>(static_cast<R>(x) * static_cast<R>(VALUE)); }
+}
+
+} // namespace detail
+
+/**
+ * @brief Mixed operators between a `Fixed` and a runtime arithmetic value.
+ *
+ * They compute the same value, with the same type, as the built-in operators
+ * after conversion of the `Fixed`. The identities that hold exactly under
+ * IEEE-754 are applied at compile time, even without optimisation:
+ *  - `x * 1`, `x / 1`, `x - 0` and `x + (-0.)` return `x`, and `x * -1` and `x / -1` return `-x`,
+ *  - on integers, `x + 0` returns `x`, `0 - x` returns `-x` and `x * 0` returns a `Fixed` zero,
+ *  - on unsigned integers, `x / 2^k` is a shift,
+ *  - on floating-point values, `x / 2^k` is a multiplication by the exact `2^-k`.
+ *
+ * Define `BIC_FAST_MATH` to 1 (or compile with `-ffast-math`) to also apply
+ * the identities that change floating-point results, see `BIC_FAST_MATH`.
+ */
+template<typename T, T VALUE, typename U> requires std::is_arithmetic_v<U>
+constexpr auto operator+(const Fixed<T, VALUE>, const U x) { return detail::fixedPlus<T, VALUE>(x); }
+
+template<typename T, T VALUE, typename U> requires std::is_arithmetic_v<U>
+constexpr auto operator+(const U x, const Fixed<T, VALUE>) { return detail::fixedPlus<T, VALUE>(x); }
+
+template<typename T, T VALUE, typename U> requires std::is_arithmetic_v<U>
+constexpr auto operator-(const U x, const Fixed<T, VALUE>)
+{
+	using R = detail::DifferenceType<U, T>;
+
+	if constexpr (VALUE == T(0) and (std::integral<R> or not detail::IS_NEGATIVE_ZERO<T, VALUE> or detail::FAST_MATH)) { return static_cast<R>(x); }
+	else                                                                                                               { return static_cast<R>(static_cast<R>(x) - static_cast<R>(VALUE)); }
+}
+
+template<typename T, T VALUE, typename U> requires std::is_arithmetic_v<U>
+constexpr auto operator-(const Fixed<T, VALUE>, const U x)
+{
+	using R = detail::DifferenceType<T, U>;
+
+	if constexpr (VALUE == T(0) and (std::integral<R> or detail::IS_NEGATIVE_ZERO<T, VALUE> or detail::FAST_MATH)) { return static_cast<R>(-static_cast<R>(x)); }
+	else                                                                                                           { return static_cast<R>(static_cast<R>(VALUE) - static_cast<R>(x)); }
+}
+
+template<typename T, T VALUE, typename U> requires std::is_arithmetic_v<U>
+constexpr auto operator*(const Fixed<T, VALUE>, const U x) { return detail::fixedTimes<T, VALUE>(x); }
+
+template<typename T, T VALUE, typename U> requires std::is_arithmetic_v<U>
+constexpr auto operator*(const U x, const Fixed<T, VALUE>) { return detail::fixedTimes<T, VALUE>(x); }
+
+template<typename T, T VALUE, typename U> requires std::is_arithmetic_v<U>
+constexpr auto operator/(const U x, const Fixed<T, VALUE>)
+{
+	using R = detail::QuotientType<U, T>;
+
+	constexpr R DIVISOR = static_cast<R>(VALUE);
+
+	if constexpr (DIVISOR == R(1))                                                             { return static_cast<R>(x); }
+	else if constexpr (std::is_signed_v<R> and DIVISOR == R(-1))                               { return static_cast<R>(-static_cast<R>(x)); }
+	else if constexpr (std::unsigned_integral<R> and detail::isPowerOfTwo(DIVISOR))            { return static_cast<R>(static_cast<R>(x) >> detail::log2(DIVISOR)); }
+	// The reciprocal of a power of two is exact, unless the divisor is so small (subnormal) that it overflows
+	else if constexpr (std::floating_point<R> and detail::isPowerOfTwo(DIVISOR < R(0) ? -DIVISOR : DIVISOR) and detail::hasFiniteReciprocal(DIVISOR)) { return static_cast<R>(static_cast<R>(x) * (R(1) / DIVISOR)); }
+	else if constexpr (std::floating_point<R> and detail::FAST_MATH and detail::hasFiniteReciprocal(DIVISOR))                                       { return static_cast<R>(static_cast<R>(x) * (R(1) / DIVISOR)); }
+	else                                                                                       { return static_cast<R>(static_cast<R>(x) / DIVISOR); }
+}
+
+template<typename T, T VALUE, typename U> requires std::is_arithmetic_v<U>
+constexpr auto operator/(const Fixed<T, VALUE>, const U x)
+{
+	using R = detail::QuotientType<T, U>;
+
+	return static_cast<R>(static_cast<R>(VALUE) / static_cast<R>(x));
+}
+
+// ============================================================================
+// Integer operators for Fixed
+// ============================================================================
+
+template<std::integral Lhs, Lhs lhs, std::integral Rhs, Rhs rhs> 
+constexpr Fixed<std::common_type_t<Lhs, Rhs>, lhs % rhs> operator%(const Fixed<Lhs, lhs>, const Fixed<Rhs, rhs>) { return {}; }
+
+template<std::integral Lhs, Lhs lhs, std::integral Rhs, Rhs rhs> 
+constexpr Fixed<std::common_type_t<Lhs, Rhs>, (lhs & rhs)> operator&(const Fixed<Lhs, lhs>, const Fixed<Rhs, rhs>) { return {}; }
+
+template<std::integral Lhs, Lhs lhs, std::integral Rhs, Rhs rhs> 
+constexpr Fixed<std::common_type_t<Lhs, Rhs>, (lhs | rhs)> operator|(const Fixed<Lhs, lhs>, const Fixed<Rhs, rhs>) { return {}; }
+
+template<std::integral Lhs, Lhs lhs, std::integral Rhs, Rhs rhs> 
+constexpr Fixed<std::common_type_t<Lhs, Rhs>, (lhs ^ rhs)> operator^(const Fixed<Lhs, lhs>, const Fixed<Rhs, rhs>) { return {}; }
+
+template<std::integral Lhs, Lhs lhs, std::integral Rhs, Rhs rhs> 
+constexpr Fixed<decltype(lhs << rhs), (lhs << rhs)> operator<<(const Fixed<Lhs, lhs>, const Fixed<Rhs, rhs>) { return {}; }
+
+template<std::integral Lhs, Lhs lhs, std::integral Rhs, Rhs rhs> 
+constexpr Fixed<decltype(lhs >> rhs), (lhs >> rhs)> operator>>(const Fixed<Lhs, lhs>, const Fixed<Rhs, rhs>) { return {}; }
+
+template<std::integral T, T value>
+constexpr Fixed<decltype(~value), ~value> operator~(const Fixed<T, value>) { return {}; }
+
+// ============================================================================
+// Integer operators between a Fixed and a runtime value
+// ============================================================================
+
+namespace detail
+{
+
+template<typename T, T VALUE, typename U>
+constexpr auto fixedAnd(const U x)
+{
+	using R = decltype(VALUE & x);
+
+	if constexpr (static_cast<R>(VALUE) == R(0))          { return Fixed<R, R(0)>{}; }
+	else if constexpr (static_cast<R>(VALUE) == R(~R(0))) { return static_cast<R>(x); }
+	else                                                  { return static_cast<R>(static_cast<R>(x) & static_cast<R>(VALUE)); }
+}
+
+template<typename T, T VALUE, typename U>
+constexpr auto fixedOr(const U x)
+{
+	using R = decltype(VALUE | x);
+
+	if constexpr (static_cast<R>(VALUE) == R(0))          { return static_cast<R>(x); }
+	else if constexpr (static_cast<R>(VALUE) == R(~R(0))) { return Fixed<R, R(~R(0))>{}; }
+	else                                                  { return static_cast<R>(static_cast<R>(x) | static_cast<R>(VALUE)); }
+}
+
+template<typename T, T VALUE, typename U>
+constexpr auto fixedXor(const U x)
+{
+	using R = decltype(VALUE ^ x);
+
+	if constexpr (static_cast<R>(VALUE) == R(0)) { return static_cast<R>(x); }
+	else                                         { return static_cast<R>(static_cast<R>(x) ^ static_cast<R>(VALUE)); }
+}
+
+} // namespace detail
+
+/**
+ * @brief Mixed integer operators between a `Fixed` and a runtime integer.
+ *
+ * As for the arithmetic ones, the value and the type are those of the
+ * built-in operators, and the trivial cases are resolved at compile time:
+ *  - `x % 1`, `x & 0` and `0 % x`, `0 << x`, `0 >> x` return a `Fixed` zero,
+ *  - `x & ~0`, `x | 0`, `x ^ 0`, `x << 0` and `x >> 0` return `x`,
+ *  - on unsigned integers, `x % 2^k` is a mask.
+ */
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator%(const U x, const Fixed<T, VALUE>)
+{
+	using R = decltype(x % VALUE);
+
+	constexpr R DIVISOR = static_cast<R>(VALUE);
+
+	if constexpr (DIVISOR == R(1) or (std::is_signed_v<R> and DIVISOR == R(-1))) { return Fixed<R, R(0)>{}; }
+	else if constexpr (std::unsigned_integral<R> and detail::isPowerOfTwo(DIVISOR)) { return static_cast<R>(static_cast<R>(x) & (DIVISOR - 1)); }
+	else                                                                            { return static_cast<R>(static_cast<R>(x) % DIVISOR); }
+}
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator%(const Fixed<T, VALUE>, const U x)
+{
+	using R = decltype(VALUE % x);
+
+	if constexpr (VALUE == T(0)) { return Fixed<R, R(0)>{}; }
+	else                         { return static_cast<R>(static_cast<R>(VALUE) % static_cast<R>(x)); }
+}
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator&(const Fixed<T, VALUE>, const U x) { return detail::fixedAnd<T, VALUE>(x); }
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator&(const U x, const Fixed<T, VALUE>) { return detail::fixedAnd<T, VALUE>(x); }
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator|(const Fixed<T, VALUE>, const U x) { return detail::fixedOr<T, VALUE>(x); }
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator|(const U x, const Fixed<T, VALUE>) { return detail::fixedOr<T, VALUE>(x); }
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator^(const Fixed<T, VALUE>, const U x) { return detail::fixedXor<T, VALUE>(x); }
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator^(const U x, const Fixed<T, VALUE>) { return detail::fixedXor<T, VALUE>(x); }
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator<<(const U x, const Fixed<T, VALUE>)
+{
+	using R = decltype(x << VALUE);
+
+	if constexpr (VALUE == T(0)) { return static_cast<R>(x); }
+	else                         { return static_cast<R>(x << VALUE); }
+}
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator<<(const Fixed<T, VALUE>, const U x)
+{
+	using R = decltype(VALUE << x);
+
+	if constexpr (VALUE == T(0)) { return Fixed<R, R(0)>{}; }
+	else                         { return static_cast<R>(VALUE << x); }
+}
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator>>(const U x, const Fixed<T, VALUE>)
+{
+	using R = decltype(x >> VALUE);
+
+	if constexpr (VALUE == T(0)) { return static_cast<R>(x); }
+	else                         { return static_cast<R>(x >> VALUE); }
+}
+
+template<std::integral T, T VALUE, std::integral U>
+constexpr auto operator>>(const Fixed<T, VALUE>, const U x)
+{
+	using R = decltype(VALUE >> x);
+
+	if constexpr (VALUE == T(0)) { return Fixed<R, R(0)>{}; }
+	else                         { return static_cast<R>(VALUE >> x); }
+}
+
 // ============================================================================
 // Logical operators for Fixed
 // ============================================================================
@@ -80,6 +384,9 @@ constexpr Fixed<bool, lhs && rhs> operator&&(const Fixed<T, lhs>, const Fixed<T,
 template<typename T, T lhs, T rhs> 
 constexpr Fixed<bool, lhs || rhs> operator||(const Fixed<T, lhs>, const Fixed<T,rhs>) { return {}; } 
 
+template<typename T, T value> 
+constexpr Fixed<bool, !value> operator!(const Fixed<T, value>) { return {}; } 
+
 // ============================================================================
 // Comparison operators for Fixed
 // ============================================================================
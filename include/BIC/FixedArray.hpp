@@ -4,8 +4,12 @@
 #include <BIC/Fixed.hpp>
 #include <BIC/FixedArrayElement.hpp>
 
+#include <algorithm> // for std::sort, std::binary_search
 #include <array>
+#include <concepts>
 #include <cstddef> // for size_t
+#include <type_traits>
+#include <utility>
 
 namespace BIC
 {
@@ -28,13 +32,13 @@ struct FixedArray
 	using Type     = std::array<T, sizeof...(VALUES)>; ///<  @brief The underlying std::array type.
 	using Iterator = typename Type::const_iterator;    ///<  @brief Const iterator type for the underlying array.
 
-	template<size_t I> using IthElement = FixedArrayElement<I, T, VALUES...>;
-
 	constexpr operator Type() const { return {VALUES...}; }  ///<  @brief Implicit conversion operator to the underlying std::array.
 	
 	static constexpr Type                             values = {VALUES...}; ///<  @brief Compile-time array of the stored values.
 	static constexpr Fixed<size_t, sizeof...(VALUES)> size   = {};          ///<  @brief Number of stored elements.
 	static constexpr Fixed<bool, size == 0>           empty  = {};
+
+	template<size_t I> using IthElement = FixedArrayElement<I, T, VALUES...>; ///<  @brief Type of the `I`th element.
 	
 	constexpr const Scalar& operator[](const size_t i) const { return values[i]; }
 
@@ -78,45 +82,177 @@ constexpr FixedIndices<INDICES...> fixedIndices = {};
 
 namespace detail
 {
-	
-template<typename T, T VALUE, T FIRST_VALUE, T... OTHER_VALUES>
-struct FixedArrayContains : Fixed<bool, VALUE == FIRST_VALUE or FixedArrayContains<T, VALUE, OTHER_VALUES...>::value> {};
 
-template<typename T, T VALUE, T FIRST_VALUE>
-struct FixedArrayContains<T, VALUE, FIRST_VALUE> : Fixed<bool, VALUE == FIRST_VALUE> {};
-	
+/**
+ * @brief Structural buffer of at most `CAPACITY` values, used as the result of constexpr algorithms.
+ *
+ * Algorithms whose output size depends on the values (filters, unique, ...)
+ * fill a `ValueBuffer` sized for the worst case during constant evaluation,
+ * then `FixedArrayFromArray` expands only its first `size()` elements.
+ */
+template<typename T, size_t CAPACITY>
+struct ValueBuffer
+{
+	using value_type = T;
+
+	std::array<T, CAPACITY> data  = {};
+	size_t                  count = 0;
+
+	constexpr void push_back(const T value) { data[count++] = value; }
+
+	constexpr size_t size() const { return count; }
+
+	constexpr const T& operator[](const size_t i) const { return data[i]; }
+};
+
+/**
+ * @brief Builds the FixedArray holding the elements of a constexpr `std::array` (or `ValueBuffer`).
+ *
+ * Algorithms on FixedArray compute their result as a constexpr array and
+ * expand it back into a FixedArray. Each element is then a reference into a
+ * single template argument, instead of an expression naming the whole input
+ * pack, which keeps the cost linear in the number of elements.
+ */
+template<auto ARRAY, typename Indices = std::make_index_sequence<ARRAY.size()>> struct FixedArrayFromArray;
+
+template<auto ARRAY, size_t... Is>
+struct FixedArrayFromArray<ARRAY, std::index_sequence<Is...>>
+{
+	using Type = FixedArray<typename decltype(ARRAY)::value_type, ARRAY[Is]...>;
+};
+
+/**
+ * @brief Values of a pack sorted in ascending order.
+ */
+template<typename T, T... VALUES>
+struct SortedValues
+{
+	static constexpr std::array<T, sizeof...(VALUES)> values = []
+	{
+		std::array<T, sizeof...(VALUES)> sorted = {VALUES...};
+		std::sort(sorted.begin(), sorted.end());
+		return sorted;
+	}();
+};
+
+/**
+ * @brief Membership test of `value` in the values of a pack.
+ *
+ * Ordered types use a binary search in the sorted values, so testing every
+ * element of an N-array against an M-array costs O(N log M) constexpr steps
+ * and no template instantiation.
+ */
+template<typename T, T... VALUES>
+constexpr bool packContains(const T value)
+{
+	if constexpr (std::totally_ordered<T>) { return std::binary_search(SortedValues<T, VALUES...>::values.begin(), SortedValues<T, VALUES...>::values.end(), value); }
+	else                                   { return ((value == VALUES) or ...); }
+}
+
 } // namespace detail
 
 template<typename T, T VALUE, T... VALUES>
-constexpr Fixed< bool, detail::FixedArrayContains<T, VALUE, VALUES...>::value > contains(const FixedArray<T, VALUES...>, const Fixed<T, VALUE>) { return {}; }
+constexpr Fixed<bool, detail::packContains<T, VALUES...>(VALUE)> contains(const FixedArray<T, VALUES...>, const Fixed<T, VALUE>) { return {}; }
 
 namespace detail
 {
 
-template<typename LhsArray, typename RhsArray>
-struct FixedArraySubstract;
-
-template<typename T, T FIRST_LHS_VALUE, T... OTHER_LHS_VALUES, T... RHS_VALUES>
-struct FixedArraySubstract< FixedArray<T, FIRST_LHS_VALUE, OTHER_LHS_VALUES...>, FixedArray<T, RHS_VALUES...> >
+/**
+ * @brief Strategy of the runtime membership test against the values of a pack.
+ */
+template<typename T, T... VALUES>
+struct RuntimeContainsTraits
 {
-	using FirstValueInRhs    = typename FixedArraySubstract< FixedArray<T, OTHER_LHS_VALUES...>, FixedArray<T, RHS_VALUES...> >::Type;
-	using FirstValueNotInRhs = decltype(cat(fixed<T, FIRST_LHS_VALUE>, FirstValueInRhs{}));
+	static constexpr size_t SIZE             = sizeof...(VALUES);
+	static constexpr size_t LINEAR_MAX_SIZE  = 16; ///< @brief Above this many values a binary search beats comparing against every value.
+
+	static constexpr T MIN = SIZE == 0 ? T{} : SortedValues<T, VALUES...>::values.front();
 
-	using Type = std::conditional_t<detail::FixedArrayContains<T, FIRST_LHS_VALUE, RHS_VALUES...>::value, 
-		FirstValueInRhs,
-		FirstValueNotInRhs>;
+	static constexpr bool BITMASK = []
+	{
+		if constexpr (std::integral<T> and not std::same_as<T, bool> and sizeof(T) <= sizeof(unsigned long long) and SIZE != 0)
+		{
+			using U = std::make_unsigned_t<T>;
+			const U span = static_cast<U>(static_cast<U>(SortedValues<T, VALUES...>::values.back()) - static_cast<U>(MIN));
+			return span < 64;
+		}
+		else { return false; }
+	}();
+
+	static constexpr bool BINARY_SEARCH = not BITMASK and SIZE > LINEAR_MAX_SIZE and std::totally_ordered<T>;
+
+	static constexpr unsigned long long MASK = []
+	{
+		unsigned long long mask = 0;
+		if constexpr (BITMASK)
+		{
+			using U = std::make_unsigned_t<T>;
+			for (const T value : SortedValues<T, VALUES...>::values) { mask |= 1ull << static_cast<U>(static_cast<U>(value) - static_cast<U>(MIN)); }
+		}
+		return mask;
+	}();
 };
 
-template<typename T, T LHS_VALUE, T... RHS_VALUES>
-struct FixedArraySubstract< FixedArray<T, LHS_VALUE>, FixedArray<T, RHS_VALUES...> >
+} // namespace detail
+
+/**
+ * @brief Tests whether a runtime `value` is one of the values of `array`.
+ *
+ * The strategy is chosen at compile time:
+ *  - integral values spanning less than 64 consecutive integers are tested with a single shift and mask,
+ *  - large ordered sets use a binary search in their sorted values,
+ *  - small sets are compared against every value without branching, a loop compilers turn into a broadcast compare.
+ */
+template<typename T, T... VALUES>
+constexpr bool contains(const FixedArray<T, VALUES...>, const std::type_identity_t<T> value)
 {
-	using Type = std::conditional_t<detail::FixedArrayContains<T, LHS_VALUE, RHS_VALUES...>::value, 
-		FixedArray<T>,
-		FixedArray<T, LHS_VALUE>>;
+	using Traits = detail::RuntimeContainsTraits<T, VALUES...>;
+
+	if constexpr (Traits::BITMASK)
+	{
+		using U = std::make_unsigned_t<T>;
+		const U offset = static_cast<U>(static_cast<U>(value) - static_cast<U>(Traits::MIN));
+		return offset < 64 and ((Traits::MASK >> offset) & 1) != 0;
+	}
+	else if constexpr (Traits::BINARY_SEARCH)
+	{
+		return std::binary_search(detail::SortedValues<T, VALUES...>::values.begin(), detail::SortedValues<T, VALUES...>::values.end(), value);
+	}
+	else
+	{
+		return (false | ... | (value == VALUES));
+	}
+}
+
+namespace detail
+{
+
+template<typename LhsArray, typename RhsArray>
+struct FixedArraySubstract;
+
+template<typename T, T... LHS_VALUES, T... RHS_VALUES>
+struct FixedArraySubstract< FixedArray<T, LHS_VALUES...>, FixedArray<T, RHS_VALUES...> >
+{
+	static constexpr ValueBuffer<T, sizeof...(LHS_VALUES)> VALUES = []
+	{
+		ValueBuffer<T, sizeof...(LHS_VALUES)> result = {};
+		for (const T value : FixedArray<T, LHS_VALUES...>::values)
+		{
+			if (not packContains<T, RHS_VALUES...>(value)) { result.push_back(value); }
+		}
+		return result;
+	}();
+
+	using Type = typename FixedArrayFromArray<VALUES>::Type;
 };
 
 } // namespace detail
 
+/**
+ * @brief Remove from `lhs` every value that belongs to `rhs`.
+ *
+ * The remaining values of `lhs` keep their order (and their duplicates).
+ */
 template<typename T, T... LHS_VALUES, T... RHS_VALUES>
 constexpr typename detail::FixedArraySubstract< FixedArray<T, LHS_VALUES...>, FixedArray<T, RHS_VALUES...> >::Type substract(const FixedArray<T, LHS_VALUES...>, const FixedArray<T, RHS_VALUES...>) { return {}; }
 
@@ -5,37 +5,55 @@
 
 #include <cstddef>
 
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define BIC_HAS_TYPE_PACK_ELEMENT
+#endif
+#endif
+
 namespace BIC
 {
 
 namespace detail
 {
-	template<size_t I, typename T, T... VALUES> struct FixedArrayElementHelper;
-
-    template<size_t I, typename T, T FIRST_VALUE, T... OTHER_VALUES> requires(I != 0)
-    struct FixedArrayElementHelper<I, T, FIRST_VALUE, OTHER_VALUES...>
-    {
-        using Type = typename FixedArrayElementHelper<I-1, T, OTHER_VALUES...>::Type;
-    };
-
-    template<size_t I, typename T, T FIRST_VALUE, T... OTHER_VALUES> requires(I == 0)
-    struct FixedArrayElementHelper<I, T, FIRST_VALUE, OTHER_VALUES...>
-    {
-        using Type = Fixed<T, FIRST_VALUE>;
-    };
+	/**
+	 * @brief Values of a pack stored once in a constexpr array.
+	 *
+	 * A built-in array is used on purpose: constant evaluation of a built-in
+	 * subscript is noticeably cheaper than a call to `std::array::operator[]`.
+	 * An empty pack still gets one (unused) element as zero-size arrays are not
+	 * allowed.
+	 */
+	template<typename T, T... VALUES>
+	struct PackValues
+	{
+		static constexpr T values[sizeof...(VALUES) == 0 ? 1 : sizeof...(VALUES)] = {VALUES...};
+	};
+
 } // namespace detail
 
 /**
  * @brief Retrieve the type of the `I`th Fixed from a FixedArray.
  *
- * @tparam I      Index to retrieve (must be zero).
+ * @tparam I      Index to retrieve.
  * @tparam T      Scalar type.
  * @tparam values elements.
  *
- * @param array The FixedArray instance (passed for type deduction).
+ * The element is accessed in O(1): with C++26 pack indexing when available,
+ * `__type_pack_element` otherwise and, as a last resort, by a lookup in the
+ * constexpr array of the values. None of them walks the pack nor instantiates
+ * a class per index, so indexing every element of a pack of size N costs O(N).
  */
+#if defined(__cpp_pack_indexing)
+template<size_t I, typename T, T... VALUES>
+using FixedArrayElement = Fixed<T, VALUES...[I]>;
+#elif defined(BIC_HAS_TYPE_PACK_ELEMENT)
+template<size_t I, typename T, T... VALUES>
+using FixedArrayElement = __type_pack_element<I, Fixed<T, VALUES>...>;
+#else
 template<size_t I, typename T, T... VALUES>
-using FixedArrayElement = typename detail::FixedArrayElementHelper<I, T, VALUES...>::Type;
+using FixedArrayElement = Fixed<T, detail::PackValues<T, VALUES...>::values[I]>;
+#endif
 
 } // namespace BIC
 
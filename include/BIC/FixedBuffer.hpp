@@ -0,0 +1,183 @@
+#ifndef BIC_FIXED_BUFFER_HPP
+#define BIC_FIXED_BUFFER_HPP
+
+/**
+ * @file FixedBuffer.hpp
+ * @brief Owning aligned buffer whose extent is a `Fixed` or a runtime size.
+ * @date 2025
+ * @version 1.0
+ *
+ * `BIC::FixedBuffer<T, Extent, ALIGNMENT>` owns `size()` elements aligned on
+ * `ALIGNMENT` bytes. With a `Fixed<size_t, N>` extent the elements are stored
+ * inline, like a `std::array`; with a `size_t` extent they are allocated on
+ * the heap. In both cases the buffer is viewed as a `FixedSpan` of the same
+ * extent, so the kernels written for `FixedSpan` get the fixed size fast path
+ * whenever the buffer has one.
+ *
+ * Example:
+ * @code
+ * template<typename Extent>
+ * void kernel(const Extent n)
+ * {
+ *     BIC::FixedBuffer<float, Extent> scratch(n); // on the stack when n is a Fixed
+ *     process(scratch.span());                      // BIC::FixedSpan<float, Extent>
+ * }
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedSpan.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Mutable.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <memory>  // for std::uninitialized_value_construct_n, std::destroy_n
+#include <new>     // for std::align_val_t
+#include <utility> // for std::exchange, std::swap
+
+namespace BIC
+{
+
+namespace detail
+{
+
+inline constexpr size_t FIXED_BUFFER_DEFAULT_ALIGNMENT = 64; ///< @brief Default alignment of a `FixedBuffer`, a cache line.
+
+} // namespace detail
+
+/**
+ * @brief Buffer of `size()` elements of type `T` aligned on `ALIGNMENT` bytes, allocated on the heap.
+ *
+ * @tparam T         Element type.
+ * @tparam Extent    `size_t`, see the specialisation for `Fixed<size_t, N>`.
+ * @tparam ALIGNMENT Alignment of the first element in bytes, a power of two.
+ */
+template<typename T, typename Extent = size_t, size_t ALIGNMENT = detail::FIXED_BUFFER_DEFAULT_ALIGNMENT>
+class FixedBuffer
+{
+	static_assert(std::same_as<Extent, size_t>, "BIC::FixedBuffer: the extent is a size_t or a Fixed<size_t, N>");
+	static_assert(ALIGNMENT != 0 and (ALIGNMENT & (ALIGNMENT - 1)) == 0, "BIC::FixedBuffer: the alignment must be a power of two");
+
+	static constexpr std::align_val_t ALIGN = std::align_val_t(ALIGNMENT < alignof(T) ? alignof(T) : ALIGNMENT);
+
+	T*     data_ = nullptr;
+	size_t size_ = 0;
+
+	static T* allocate(const size_t size)
+	{
+		if (size == 0) { return nullptr; }
+
+		T* const data = static_cast<T*>(::operator new(size*sizeof(T), ALIGN));
+		try { std::uninitialized_value_construct_n(data, size); }
+		catch (...) { ::operator delete(data, ALIGN); throw; }
+		return data;
+	}
+
+	void release()
+	{
+		if (data_ == nullptr) { return; }
+
+		std::destroy_n(data_, size_);
+		::operator delete(data_, ALIGN);
+	}
+
+public:
+	using element_type = T;
+	using value_type   = T;
+	using size_type    = size_t;
+
+	static constexpr bool IS_FIXED = false; ///< @brief Whether the extent is known at compile time.
+
+	FixedBuffer() = default;
+
+	/**
+	 * @brief Allocates `size` value-initialised elements.
+	 */
+	explicit FixedBuffer(const size_t size) : data_(allocate(size)), size_(size) {}
+
+	FixedBuffer(const FixedBuffer& other) : FixedBuffer(other.size_)
+	{
+		for (size_t i = 0; i != size_; ++i) { data_[i] = other.data_[i]; }
+	}
+
+	FixedBuffer(FixedBuffer&& other) noexcept : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+	FixedBuffer& operator=(FixedBuffer other) noexcept
+	{
+		std::swap(data_, other.data_);
+		std::swap(size_, other.size_);
+		return *this;
+	}
+
+	~FixedBuffer() { release(); }
+
+	T*       data()       { return data_; } ///< @brief Pointer to the first element.
+	const T* data() const { return data_; } ///< @brief Pointer to the first element.
+
+	size_t size()  const { return size_; }      ///< @brief Number of elements.
+	bool   empty() const { return size_ == 0; } ///< @brief Whether the buffer is empty.
+
+	T&       operator[](const size_t i)       { return data_[i]; } ///< @brief `i`-th element.
+	const T& operator[](const size_t i) const { return data_[i]; } ///< @brief `i`-th element.
+
+	T*       begin()       { return data_; }         ///< @brief Iterator to the first element.
+	const T* begin() const { return data_; }         ///< @brief Iterator to the first element.
+	T*       end()         { return data_ + size_; } ///< @brief Iterator past the last element.
+	const T* end()   const { return data_ + size_; } ///< @brief Iterator past the last element.
+
+	FixedSpan<T, size_t>       span()       { return {data_, size_}; } ///< @brief View over the elements.
+	FixedSpan<const T, size_t> span() const { return {data_, size_}; } ///< @brief View over the elements.
+
+	operator FixedSpan<T, size_t>()             { return span(); } ///< @brief Implicit conversion to a view over the elements.
+	operator FixedSpan<const T, size_t>() const { return span(); } ///< @brief Implicit conversion to a view over the elements.
+};
+
+/**
+ * @brief Buffer of `N` elements of type `T` aligned on `ALIGNMENT` bytes, stored inline.
+ */
+template<typename T, size_t N, size_t ALIGNMENT>
+class FixedBuffer<T, Fixed<size_t, N>, ALIGNMENT>
+{
+	static_assert(ALIGNMENT != 0 and (ALIGNMENT & (ALIGNMENT - 1)) == 0, "BIC::FixedBuffer: the alignment must be a power of two");
+
+	alignas(ALIGNMENT < alignof(T) ? alignof(T) : ALIGNMENT) T data_[N == 0 ? 1 : N] = {};
+
+public:
+	using element_type = T;
+	using value_type   = T;
+	using size_type    = size_t;
+
+	static constexpr bool IS_FIXED = true; ///< @brief Whether the extent is known at compile time.
+
+	constexpr FixedBuffer() = default;
+
+	/**
+	 * @brief Value-initialised elements; the size argument makes the construction generic over the extent.
+	 */
+	constexpr explicit FixedBuffer(const Fixed<size_t, N>) {}
+
+	constexpr T*       data()       { return data_; } ///< @brief Pointer to the first element.
+	constexpr const T* data() const { return data_; } ///< @brief Pointer to the first element.
+
+	constexpr Fixed<size_t, N>    size()  const { return {}; } ///< @brief Number of elements.
+	constexpr Fixed<bool, N == 0> empty() const { return {}; } ///< @brief Whether the buffer is empty.
+
+	constexpr T&       operator[](const size_t i)       { return data_[i]; } ///< @brief `i`-th element.
+	constexpr const T& operator[](const size_t i) const { return data_[i]; } ///< @brief `i`-th element.
+
+	constexpr T*       begin()       { return data_; }     ///< @brief Iterator to the first element.
+	constexpr const T* begin() const { return data_; }     ///< @brief Iterator to the first element.
+	constexpr T*       end()         { return data_ + N; } ///< @brief Iterator past the last element.
+	constexpr const T* end()   const { return data_ + N; } ///< @brief Iterator past the last element.
+
+	constexpr FixedSpan<T, Fixed<size_t, N>>       span()       { return {data_, {}}; } ///< @brief View over the elements.
+	constexpr FixedSpan<const T, Fixed<size_t, N>> span() const { return {data_, {}}; } ///< @brief View over the elements.
+
+	constexpr operator FixedSpan<T, Fixed<size_t, N>>()             { return span(); } ///< @brief Implicit conversion to a view over the elements.
+	constexpr operator FixedSpan<const T, Fixed<size_t, N>>() const { return span(); } ///< @brief Implicit conversion to a view over the elements.
+};
+
+} // namespace BIC
+
+#endif // BIC_FIXED_BUFFER_HPP
@@ -0,0 +1,233 @@
+#ifndef BIC_FIXED_MAP_HPP
+#define BIC_FIXED_MAP_HPP
+
+/**
+ * @file FixedMap.hpp
+ * @brief Perfect hash map from a compile-time set of integral keys to dense indices.
+ * @date 2025
+ * @version 1.0
+ *
+ * `BIC::FixedMap` maps a runtime key to the position of that key in a
+ * `FixedArray`. The hash function, a single multiply-shift, is searched
+ * during constant evaluation until it is collision-free on the keys, so a
+ * lookup is one multiplication, one shift, one load from a table in
+ * read-only memory and one comparison. No allocation is ever performed.
+ *
+ * Example:
+ * @code
+ * constexpr auto channels = BIC::fixedMap<int, 17, 4242, -3, 1001>;
+ *
+ * const size_t slot = channels.find(id);                   // position of id among the keys, channels.npos when absent
+ * channels.visit(id, [](const auto ID) { handle(ID); });   // ID is a Fixed<int, id> when id is a key, int otherwise
+ * @endcode
+ */
+
+#include <BIC/Dispatch.hpp>
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedArray.hpp>
+
+#include <algorithm> // for std::adjacent_find
+#include <array>
+#include <bit>       // for std::bit_width
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/**
+ * @brief Parameters of the hash `(key * multiplier) >> (64 - bits)`.
+ */
+struct MultiplyShiftHash
+{
+	unsigned long long multiplier; ///< @brief Odd multiplier, 0 when no perfect hash was found.
+	unsigned           bits;       ///< @brief Base 2 logarithm of the number of slots.
+};
+
+/**
+ * @brief Constant evaluated search of a collision-free multiply-shift hash for a set of keys.
+ *
+ * Multipliers are drawn from a fixed splitmix64 sequence, so the result is
+ * reproducible across compilers. The table starts with the smallest power of
+ * two holding every key and doubles, up to `MAX_EXTRA_BITS` times, when no
+ * multiplier among `ATTEMPTS` is collision-free.
+ */
+template<typename K, K... KEYS>
+struct PerfectHashSearch
+{
+	static constexpr size_t   SIZE           = sizeof...(KEYS);
+	static constexpr unsigned MIN_BITS       = SIZE <= 1 ? 0 : static_cast<unsigned>(std::bit_width(SIZE - 1));
+	static constexpr unsigned MAX_EXTRA_BITS = 6;    ///< @brief The table holds at most 64 slots per key.
+	static constexpr size_t   ATTEMPTS       = 1024; ///< @brief Number of multipliers tried per table size.
+
+	static constexpr unsigned long long splitmix64(unsigned long long& state)
+	{
+		unsigned long long z = (state += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	static constexpr size_t hash(const K key, const unsigned long long multiplier, const unsigned bits)
+	{
+		return bits == 0 ? 0 : static_cast<size_t>((static_cast<unsigned long long>(key) * multiplier) >> (64 - bits));
+	}
+
+	static constexpr MultiplyShiftHash HASH = []
+	{
+		std::array<unsigned long long, ((size_t(1) << (MIN_BITS + MAX_EXTRA_BITS)) + 63) / 64> occupied = {};
+
+		unsigned long long state = 0;
+		for (unsigned bits = MIN_BITS; bits <= MIN_BITS + MAX_EXTRA_BITS; ++bits)
+		{
+			const size_t words = ((size_t(1) << bits) + 63) / 64;
+
+			for (size_t attempt = 0; attempt != ATTEMPTS; ++attempt)
+			{
+				const unsigned long long multiplier = splitmix64(state) | 1;
+
+				for (size_t i = 0; i != words; ++i) { occupied[i] = 0; }
+
+				bool injective = true;
+				for (const K key : FixedArray<K, KEYS...>::values)
+				{
+					const size_t slot = hash(key, multiplier, bits);
+					const unsigned long long bit = 1ull << (slot % 64);
+					if (occupied[slot / 64] & bit) { injective = false; break; }
+					occupied[slot / 64] |= bit;
+				}
+
+				if (injective) { return MultiplyShiftHash{multiplier, bits}; }
+			}
+		}
+		return MultiplyShiftHash{0, 0};
+	}();
+};
+
+} // namespace detail
+
+template<typename Keys> struct FixedMap;
+
+/**
+ * @brief Perfect hash map from the keys of a FixedArray to their positions.
+ *
+ * @tparam K    Integral key type, at most 64 bits wide.
+ * @tparam KEYS Distinct keys.
+ *
+ * Every slot of the table stores a key and its position, empty slots store
+ * the position `npos`. A lookup hashes the key, loads its slot and compares
+ * the stored key with the searched one.
+ */
+template<std::integral K, K... KEYS>
+struct FixedMap< FixedArray<K, KEYS...> >
+{
+	static_assert(sizeof(K) <= sizeof(unsigned long long), "FixedMap keys must be at most 64 bits wide");
+	static_assert(std::adjacent_find(detail::SortedValues<K, KEYS...>::values.begin(), detail::SortedValues<K, KEYS...>::values.end()) == detail::SortedValues<K, KEYS...>::values.end(), "FixedMap keys must be distinct");
+
+	using Key   = K;                                                                        ///< @brief Key type.
+	using Keys  = FixedArray<K, KEYS...>;                                                   ///< @brief FixedArray of the keys, in the order of their positions.
+	using Index = std::conditional_t<(sizeof...(KEYS) < 0xFFFF), unsigned short, size_t>; ///< @brief Type of the positions stored in the table.
+
+	static constexpr Fixed<size_t, sizeof...(KEYS)> size = {};              ///< @brief Number of keys.
+	static constexpr size_t                         npos = sizeof...(KEYS); ///< @brief Position returned for a key absent from the map.
+
+private:
+	using Search = detail::PerfectHashSearch<K, KEYS...>;
+
+	static_assert(Search::HASH.multiplier != 0, "no collision-free multiply-shift hash was found for these keys, use BIC::dispatch instead");
+
+	static constexpr unsigned long long MULTIPLIER = Search::HASH.multiplier;
+	static constexpr unsigned           BITS       = Search::HASH.bits;
+	static constexpr size_t             SLOTS      = size_t(1) << BITS;
+
+public:
+	/**
+	 * @brief Slot of `key` in the table, collision-free over the keys.
+	 */
+	static constexpr size_t hash(const K key)
+	{
+		if constexpr (BITS == 0) { return 0; }
+		else                     { return static_cast<size_t>((static_cast<unsigned long long>(key) * MULTIPLIER) >> (64 - BITS)); }
+	}
+
+private:
+	struct Slot
+	{
+		K     key;
+		Index index;
+	};
+
+	static constexpr std::array<Slot, SLOTS> TABLE = []
+	{
+		std::array<Slot, SLOTS> table = {};
+		table.fill(Slot{K{}, static_cast<Index>(npos)});
+		for (size_t i = 0; i != npos; ++i) { table[hash(Keys::values[i])] = Slot{Keys::values[i], static_cast<Index>(i)}; }
+		return table;
+	}();
+
+	template<typename Result, typename Func, typename Fallback, typename Indices = std::make_index_sequence<npos>> struct Visitor;
+
+	template<typename Result, typename Func, typename Fallback, size_t... Is>
+	struct Visitor<Result, Func, Fallback, std::index_sequence<Is...>>
+	{
+		using Entry = Result(*)(Func&, Fallback&, K);
+
+		template<K KEY>
+		static constexpr Result callFunc(Func& func, Fallback&, const K) { return func(fixed<K, KEY>); }
+
+		static constexpr Result callFallback(Func&, Fallback& fallback, const K key) { return fallback(key); }
+
+		// Indexed by position, the last entry handles absent keys
+		static constexpr Entry ENTRIES[npos + 1] = {&callFunc<Keys::values[Is]>..., &callFallback};
+	};
+
+public:
+	/**
+	 * @brief Position of `key` among the keys, `npos` when it is absent.
+	 */
+	static constexpr size_t find(const std::type_identity_t<K> key)
+	{
+		const Slot& slot = TABLE[hash(key)];
+		return slot.key == key ? slot.index : npos;
+	}
+
+	/**
+	 * @brief Whether `key` is one of the keys.
+	 */
+	static constexpr bool contains(const std::type_identity_t<K> key) { return find(key) != npos; }
+
+	/**
+	 * @brief Call `func` with the `Fixed` key equal to `key`, or `fallback` with `key` when it is absent.
+	 *
+	 * The position found by the hash indexes a table of function pointers, so
+	 * the call costs one lookup and one indirect call whatever the number of keys.
+	 */
+	template<typename Func, typename Fallback>
+	static constexpr detail::DispatchResult<std::remove_reference_t<Func>, std::remove_reference_t<Fallback>, K, KEYS...> visit(const std::type_identity_t<K> key, Func&& func, Fallback&& fallback)
+	{
+		using Result = detail::DispatchResult<std::remove_reference_t<Func>, std::remove_reference_t<Fallback>, K, KEYS...>;
+
+		return Visitor<Result, std::remove_reference_t<Func>, std::remove_reference_t<Fallback>>::ENTRIES[find(key)](func, fallback, key);
+	}
+
+	/**
+	 * @brief Call `func` with the `Fixed` key equal to `key`, or with `key` itself when it is absent.
+	 */
+	template<typename Func>
+	static constexpr detail::DispatchResult<std::remove_reference_t<Func>, std::remove_reference_t<Func>, K, KEYS...> visit(const std::type_identity_t<K> key, Func&& func)
+	{
+		return visit(key, func, func);
+	}
+};
+
+template<typename K, K... KEYS>
+inline constexpr FixedMap< FixedArray<K, KEYS...> > fixedMap = {};
+
+} // namespace BIC
+
+#endif // BIC_FIXED_MAP_HPP
@@ -0,0 +1,203 @@
+#ifndef BIC_FIXED_SPAN_HPP
+#define BIC_FIXED_SPAN_HPP
+
+/**
+ * @file FixedSpan.hpp
+ * @brief Contiguous view whose extent is a `Fixed` or a runtime size.
+ * @date 2025
+ * @version 1.0
+ *
+ * `BIC::FixedSpan<T, Extent>` replaces the `(pointer, size)` pairs passed to
+ * kernels. `Extent` is either `size_t` or a `Fixed<size_t, N>`; a fixed
+ * extent takes no storage, the view being a single pointer, and `size()`
+ * returns it as a `Fixed`, so loops bounded by `size()` or running from
+ * `begin()` to `end()` are fully known to the compiler and unroll or
+ * vectorise without remainder.
+ *
+ * A `FixedSpan` converts implicitly from and to the matching `std::span`.
+ *
+ * Example:
+ * @code
+ * template<typename Extent>
+ * void axpy(const float alpha, const BIC::FixedSpan<const float, Extent> x, const BIC::FixedSpan<float, Extent> y)
+ * {
+ *     for (size_t i = 0; i != y.size(); ++i) { y[i] += alpha*x[i]; }
+ * }
+ *
+ * std::array<float, 16> x, y;
+ * axpy(2.f, BIC::FixedSpan(x), BIC::FixedSpan(y));   // Extent is BIC::Fixed<size_t, 16>
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Mutable.hpp>
+#include <BIC/Stored.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <ranges>  // for std::ranges::enable_borrowed_range
+#include <span>
+#include <type_traits>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/// `std::span` extent matching a `FixedSpan` extent.
+template<typename Extent> inline constexpr size_t SPAN_EXTENT = std::dynamic_extent;
+
+template<size_t N> inline constexpr size_t SPAN_EXTENT<Fixed<size_t, N>> = N;
+
+/// `FixedSpan` extent matching a `std::span` extent.
+template<size_t N> struct SpanExtentTraits { using Type = Fixed<size_t, N>; };
+
+template<> struct SpanExtentTraits<std::dynamic_extent> { using Type = size_t; };
+
+template<size_t N>
+using SpanExtent = typename SpanExtentTraits<N>::Type;
+
+/// `FixedSpan` extent deduced from a size: itself for a `Fixed`, `size_t` for a runtime integer.
+template<typename Extent>
+using SpanExtentOf = std::conditional_t<IsFixed<Extent>::value, Extent, size_t>;
+
+/// `size` as an `Extent`: itself for `size_t`, the `Fixed` otherwise, `size` being then its value.
+template<typename Extent>
+constexpr Extent toExtent([[maybe_unused]] const size_t size)
+{
+	if constexpr (IsFixed<Extent>::value) { return Extent{}; }
+	else                                  { return size; }
+}
+
+/// Elements of type `From` may be viewed as elements of type `To`, e.g. `float` as `const float`.
+template<typename From, typename To>
+concept SpanConvertible = std::is_convertible_v<From(*)[], To(*)[]>;
+
+} // namespace detail
+
+/**
+ * @brief View over `size()` contiguous elements of type `T`.
+ *
+ * @tparam T      Element type, `const` qualified for a read-only view.
+ * @tparam Extent `size_t`, or `Fixed<size_t, N>` for a size known at compile time.
+ */
+template<typename T, typename Extent = size_t>
+class FixedSpan
+{
+	static_assert(std::same_as<Extent, size_t> or std::same_as<Mutable<Extent>, size_t>, "BIC::FixedSpan: the extent is a size_t or a Fixed<size_t, N>");
+
+	T*                                   data_ = nullptr;
+	BIC_NO_UNIQUE_ADDRESS Stored<Extent> size_;
+
+public:
+	using element_type = T;
+	using value_type   = std::remove_cv_t<T>;
+	using size_type    = size_t;
+	using pointer      = T*;
+	using reference    = T&;
+	using iterator     = T*;
+
+	static constexpr bool   IS_FIXED = IsFixed<Extent>::value;        ///< @brief Whether the extent is known at compile time.
+	static constexpr size_t extent   = detail::SPAN_EXTENT<Extent>; ///< @brief Extent of the matching `std::span`.
+
+	constexpr FixedSpan() requires (not IS_FIXED or extent == 0) = default;
+
+	/**
+	 * @brief View over the `size` elements starting at `data`.
+	 */
+	constexpr FixedSpan(T* const data, const Extent size) : data_(data), size_(size) {}
+
+	/**
+	 * @brief View over a C array.
+	 */
+	template<typename U, size_t N> requires detail::SpanConvertible<U, T> and (not IS_FIXED or N == extent)
+	constexpr FixedSpan(U (&array)[N]) : data_(array), size_(detail::toExtent<Extent>(N)) {}
+
+	/**
+	 * @brief View over a `std::array`.
+	 */
+	template<typename U, size_t N> requires detail::SpanConvertible<U, T> and (not IS_FIXED or N == extent)
+	constexpr FixedSpan(std::array<U, N>& array) : data_(array.data()), size_(detail::toExtent<Extent>(N)) {}
+
+	template<typename U, size_t N> requires detail::SpanConvertible<const U, T> and (not IS_FIXED or N == extent)
+	constexpr FixedSpan(const std::array<U, N>& array) : data_(array.data()), size_(detail::toExtent<Extent>(N)) {}
+
+	/**
+	 * @brief View over a `std::span`, explicit when a runtime extent becomes fixed as for `std::span`.
+	 *
+	 * The size of `span` must then be `extent`.
+	 */
+	template<typename U, size_t N> requires detail::SpanConvertible<U, T> and (not IS_FIXED or N == extent or N == std::dynamic_extent)
+	constexpr explicit(IS_FIXED and N == std::dynamic_extent) FixedSpan(const std::span<U, N> span) : data_(span.data()), size_(detail::toExtent<Extent>(span.size())) {}
+
+	/**
+	 * @brief Converts another `FixedSpan`, explicit when a runtime extent becomes fixed.
+	 */
+	template<typename U, typename OtherExtent> requires detail::SpanConvertible<U, T> and (not IS_FIXED or std::same_as<OtherExtent, Extent> or std::same_as<OtherExtent, size_t>)
+	constexpr explicit(IS_FIXED and not IsFixed<OtherExtent>::value) FixedSpan(const FixedSpan<U, OtherExtent> other) : data_(other.data()), size_(detail::toExtent<Extent>(other.size())) {}
+
+	/**
+	 * @brief Converts to a `std::span` of the same fixed extent.
+	 *
+	 * Conversions to a `std::span` of runtime extent go through its constructor from contiguous borrowed ranges.
+	 */
+	template<typename U, size_t N> requires detail::SpanConvertible<T, U> and (IS_FIXED and N == extent)
+	constexpr operator std::span<U, N>() const { return std::span<U, N>(data_, N); }
+
+	constexpr T*     data()  const { return data_; }        ///< @brief Pointer to the first element.
+	constexpr Extent size()  const { return size_.get(); }  ///< @brief Number of elements, a `Fixed` when the extent is.
+	constexpr auto   empty() const { return size() == Fixed<size_t, 0>{}; } ///< @brief Whether the view is empty, a `Fixed` when the extent is.
+
+	constexpr auto size_bytes() const { return size() * Fixed<size_t, sizeof(T)>{}; } ///< @brief Size of the viewed elements in bytes.
+
+	constexpr T& operator[](const size_t i) const { return data_[i]; } ///< @brief `i`-th element.
+
+	constexpr T* begin() const { return data_; }          ///< @brief Iterator to the first element.
+	constexpr T* end()   const { return data_ + size(); } ///< @brief Iterator past the last element.
+
+	/**
+	 * @brief View over the first `count` elements, of fixed extent when `count` is a `Fixed`.
+	 */
+	template<typename Count> requires std::same_as<Mutable<Count>, size_t>
+	constexpr FixedSpan<T, Count> first(const Count count) const { return {data_, count}; }
+
+	/**
+	 * @brief View over the last `count` elements, of fixed extent when `count` is a `Fixed`.
+	 */
+	template<typename Count> requires std::same_as<Mutable<Count>, size_t>
+	constexpr FixedSpan<T, Count> last(const Count count) const { return {data_ + (size() - count), count}; }
+
+	/**
+	 * @brief View over the `count` elements starting at `offset`, of fixed extent when `count` is a `Fixed`.
+	 */
+	template<typename Offset, typename Count> requires std::same_as<Mutable<Offset>, size_t> and std::same_as<Mutable<Count>, size_t>
+	constexpr FixedSpan<T, Count> subspan(const Offset offset, const Count count) const { return {data_ + offset, count}; }
+};
+
+template<typename T, typename Extent> requires std::integral<Mutable<Extent>> and (not IsFixed<Extent>::value or std::same_as<Mutable<Extent>, size_t>)
+FixedSpan(T*, Extent) -> FixedSpan<T, detail::SpanExtentOf<Extent>>;
+
+template<typename T, size_t N>
+FixedSpan(T (&)[N]) -> FixedSpan<T, Fixed<size_t, N>>;
+
+template<typename T, size_t N>
+FixedSpan(std::array<T, N>&) -> FixedSpan<T, Fixed<size_t, N>>;
+
+template<typename T, size_t N>
+FixedSpan(const std::array<T, N>&) -> FixedSpan<const T, Fixed<size_t, N>>;
+
+template<typename T, size_t N>
+FixedSpan(std::span<T, N>) -> FixedSpan<T, detail::SpanExtent<N>>;
+
+} // namespace BIC
+
+/**
+ * @brief A `FixedSpan` does not own its elements: a temporary view converts to a `std::span` of runtime extent.
+ */
+template<typename T, typename Extent>
+inline constexpr bool std::ranges::enable_borrowed_range<BIC::FixedSpan<T, Extent>> = true;
+
+#endif // BIC_FIXED_SPAN_HPP
@@ -0,0 +1,182 @@
+#ifndef BIC_INTEGER_HPP
+#define BIC_INTEGER_HPP
+
+/**
+ * @file Integer.hpp
+ * @brief Integer helpers (min, max, gcd, lcm, log2, popcount, alignment) preserving `Fixed`.
+ * @date 2025
+ * @version 1.0
+ *
+ * Every function accepts runtime integers, `Fixed` integers or a mix of
+ * both. When all the arguments are `Fixed` the result is a `Fixed` too, so
+ * offsets and strides computed from compile-time sizes stay compile-time
+ * constants through any number of steps.
+ *
+ * Example:
+ * @code
+ * constexpr auto LANES  = BIC::fixed<size_t, 8>;
+ * constexpr auto STRIDE = BIC::alignUp(BIC::fixed<size_t, 21>, LANES); // BIC::Fixed<size_t, 24>
+ * const size_t offset   = BIC::alignDown(i, LANES);                   // i & ~7
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Mutable.hpp>
+
+#include <bit>         // for std::popcount, std::bit_width
+#include <concepts>
+#include <numeric>     // for std::gcd, std::lcm
+#include <type_traits>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/// A runtime integer or a `Fixed` integer, `bool` excluded.
+template<typename T>
+concept IntegerLike = std::integral<Mutable<T>> and not std::same_as<Mutable<T>, bool>;
+
+template<typename... Ts>
+inline constexpr bool ALL_FIXED = (IsFixed<Ts>::value and ...);
+
+/// `A` and `B` are not integers of different signedness, which their common type would compare as unsigned.
+template<typename A, typename B>
+concept SameSignedness = not (std::integral<Mutable<A>> and std::integral<Mutable<B>>) or std::is_signed_v<Mutable<A>> == std::is_signed_v<Mutable<B>>;
+
+template<std::integral T>
+constexpr auto toUnsigned(const T x) { return static_cast<std::make_unsigned_t<T>>(x); }
+
+template<typename R>
+constexpr R alignUp(const R x, const R alignment) { return (x + (alignment - 1)) & ~(alignment - 1); }
+
+template<typename R>
+constexpr R alignDown(const R x, const R alignment) { return x & ~(alignment - 1); }
+
+} // namespace detail
+
+/**
+ * @brief Smallest of `a` and `b`, in their common type; a `Fixed` when both are.
+ *
+ * Integers of different signedness are rejected, as `-1` would not compare below `2u` in their common type.
+ */
+template<typename A, typename B> requires std::is_arithmetic_v<Mutable<A>> and std::is_arithmetic_v<Mutable<B>> and detail::SameSignedness<A, B>
+constexpr auto min(const A a, const B b)
+{
+	using R = std::common_type_t<Mutable<A>, Mutable<B>>;
+
+	if constexpr (detail::ALL_FIXED<A, B>) { return Fixed<R, (static_cast<R>(B::value) < static_cast<R>(A::value) ? static_cast<R>(B::value) : static_cast<R>(A::value))>{}; }
+	else                                   { return static_cast<R>(b) < static_cast<R>(a) ? static_cast<R>(b) : static_cast<R>(a); }
+}
+
+/**
+ * @brief Largest of `a` and `b`, in their common type; a `Fixed` when both are.
+ *
+ * Integers of different signedness are rejected, as `-1` would not compare below `2u` in their common type.
+ */
+template<typename A, typename B> requires std::is_arithmetic_v<Mutable<A>> and std::is_arithmetic_v<Mutable<B>> and detail::SameSignedness<A, B>
+constexpr auto max(const A a, const B b)
+{
+	using R = std::common_type_t<Mutable<A>, Mutable<B>>;
+
+	if constexpr (detail::ALL_FIXED<A, B>) { return Fixed<R, (static_cast<R>(A::value) < static_cast<R>(B::value) ? static_cast<R>(B::value) : static_cast<R>(A::value))>{}; }
+	else                                   { return static_cast<R>(a) < static_cast<R>(b) ? static_cast<R>(b) : static_cast<R>(a); }
+}
+
+/**
+ * @brief Greatest common divisor of `a` and `b`, as `std::gcd`; a `Fixed` when both are.
+ */
+template<detail::IntegerLike A, detail::IntegerLike B>
+constexpr auto gcd(const A a, const B b)
+{
+	using R = std::common_type_t<Mutable<A>, Mutable<B>>;
+
+	if constexpr (detail::ALL_FIXED<A, B>) { return Fixed<R, std::gcd(A::value, B::value)>{}; }
+	else                                   { return static_cast<R>(std::gcd(static_cast<Mutable<A>>(a), static_cast<Mutable<B>>(b))); }
+}
+
+/**
+ * @brief Least common multiple of `a` and `b`, as `std::lcm`; a `Fixed` when both are.
+ */
+template<detail::IntegerLike A, detail::IntegerLike B>
+constexpr auto lcm(const A a, const B b)
+{
+	using R = std::common_type_t<Mutable<A>, Mutable<B>>;
+
+	if constexpr (detail::ALL_FIXED<A, B>) { return Fixed<R, std::lcm(A::value, B::value)>{}; }
+	else                                   { return static_cast<R>(std::lcm(static_cast<Mutable<A>>(a), static_cast<Mutable<B>>(b))); }
+}
+
+/**
+ * @brief Number of bits set in `x`, as an `int`; a `Fixed` when `x` is.
+ */
+template<detail::IntegerLike X>
+constexpr auto popcount(const X x)
+{
+	if constexpr (detail::ALL_FIXED<X>) { return Fixed<int, std::popcount(detail::toUnsigned(X::value))>{}; }
+	else                                { return std::popcount(detail::toUnsigned(static_cast<Mutable<X>>(x))); }
+}
+
+/**
+ * @brief `floor(log2(x))` for `x > 0`, as an `int`; a `Fixed` when `x` is.
+ */
+template<detail::IntegerLike X>
+constexpr auto log2(const X x)
+{
+	if constexpr (detail::ALL_FIXED<X>)
+	{
+		static_assert(X::value > 0, "BIC::log2: the argument must be positive");
+		return Fixed<int, std::bit_width(detail::toUnsigned(X::value)) - 1>{};
+	}
+	else { return static_cast<int>(std::bit_width(detail::toUnsigned(static_cast<Mutable<X>>(x)))) - 1; }
+}
+
+/**
+ * @brief Whether `x` is a positive power of two; a `Fixed` when `x` is.
+ */
+template<detail::IntegerLike X>
+constexpr auto isPowerOfTwo(const X x)
+{
+	if constexpr (detail::ALL_FIXED<X>) { return Fixed<bool, detail::isPowerOfTwo(X::value)>{}; }
+	else                                { return detail::isPowerOfTwo(static_cast<Mutable<X>>(x)); }
+}
+
+/**
+ * @brief Smallest multiple of `alignment` not lower than `x`; a `Fixed` when both are.
+ *
+ * @param x         Value to align.
+ * @param alignment A power of two, checked at compile time when it is a `Fixed`.
+ */
+template<detail::IntegerLike X, detail::IntegerLike A>
+constexpr auto alignUp(const X x, const A alignment)
+{
+	using R = std::common_type_t<Mutable<X>, Mutable<A>>;
+
+	if constexpr (IsFixed<A>::value) { static_assert(detail::isPowerOfTwo(A::value), "BIC::alignUp: the alignment must be a power of two"); }
+
+	if constexpr (detail::ALL_FIXED<X, A>) { return Fixed<R, detail::alignUp<R>(X::value, A::value)>{}; }
+	else                                   { return detail::alignUp<R>(static_cast<R>(x), static_cast<R>(alignment)); }
+}
+
+/**
+ * @brief Largest multiple of `alignment` not greater than `x`; a `Fixed` when both are.
+ *
+ * @param x         Value to align.
+ * @param alignment A power of two, checked at compile time when it is a `Fixed`.
+ */
+template<detail::IntegerLike X, detail::IntegerLike A>
+constexpr auto alignDown(const X x, const A alignment)
+{
+	using R = std::common_type_t<Mutable<X>, Mutable<A>>;
+
+	if constexpr (IsFixed<A>::value) { static_assert(detail::isPowerOfTwo(A::value), "BIC::alignDown: the alignment must be a power of two"); }
+
+	if constexpr (detail::ALL_FIXED<X, A>) { return Fixed<R, detail::alignDown<R>(X::value, A::value)>{}; }
+	else                                   { return detail::alignDown<R>(static_cast<R>(x), static_cast<R>(alignment)); }
+}
+
+} // namespace BIC
+
+#endif // BIC_INTEGER_HPP
@@ -1,10 +1,16 @@
 #ifndef BIC_LOOPS_HPP
 #define BIC_LOOPS_HPP
 
+#include <BIC/Dispatch.hpp>
 #include <BIC/Fixed.hpp>
 #include <BIC/FixedArray.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Mutable.hpp>
 #include <BIC/Seq.hpp>
 
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
 #include <utility>
 
 namespace BIC
@@ -18,6 +24,233 @@ constexpr UnaryFunc&& foreach(Fixed<Size, FIRST>, Fixed<Size, BOUND>, UnaryFunc&
 
 template<typename Size, Size FIRST, Size BOUND, Size STEP, typename UnaryFunc> 
 constexpr UnaryFunc&& foreach(Fixed<Size, FIRST>, Fixed<Size, BOUND>, Fixed<Size, STEP>, UnaryFunc&& func) { return foreach(seq<Size, FIRST, BOUND, STEP>, std::forward<UnaryFunc>(func)); }
+
+// ============================================================================
+// Hybrid unrolling
+// ============================================================================
+
+/**
+ * @brief Unrolling policy for `foreach`.
+ *
+ * @tparam MAX_FULL_UNROLL Loops of at most this many iterations are fully unrolled.
+ * @tparam BLOCK_SIZE      Longer loops become a real loop whose body is unrolled `BLOCK_SIZE` times.
+ *
+ * Fully unrolling thousands of iterations trashes the instruction cache and
+ * slows down compilation and linking. Under an `UnrollPolicy`, short loops
+ * are still fully unrolled (every index is a `Fixed`) while long loops are
+ * emitted as a runtime loop over blocks of `BLOCK_SIZE` iterations, followed
+ * by a fully unrolled remainder whose indices are `Fixed` again.
+ *
+ * The body is called either as `func(i)` or, when it accepts two arguments, as
+ * `func(i, lane)` where `lane` is the `Fixed<size_t, k % BLOCK_SIZE>` position
+ * of the `k`-th iteration within its block. The lane is always a `Fixed`, even
+ * when `i` is not, which makes it suitable to index `BLOCK_SIZE` independent
+ * accumulators.
+ *
+ * Example:
+ * @code
+ * double acc[4] = {};
+ * BIC::foreach(BIC::unrollPolicy<32, 4>, BIC::fixed<int,0>, BIC::fixed<int,4096>, [&](const auto i, const auto lane)
+ * {
+ *     acc[lane] += x[i]; // i is an int, lane a Fixed<size_t, 0..3>
+ * });
+ * @endcode
+ */
+template<size_t MAX_FULL_UNROLL, size_t BLOCK_SIZE>
+struct UnrollPolicy
+{
+	static_assert(BLOCK_SIZE > 0, "BIC::UnrollPolicy: the block size must be positive");
+
+	static constexpr Fixed<size_t, MAX_FULL_UNROLL> maxFullUnroll = {}; ///<  @brief Maximum trip count that is fully unrolled.
+	static constexpr Fixed<size_t, BLOCK_SIZE>      blockSize     = {}; ///<  @brief Unrolling factor of longer loops.
+};
+
+/**
+ * @brief Global constexpr instance of `UnrollPolicy`.
+ */
+template<size_t MAX_FULL_UNROLL, size_t BLOCK_SIZE>
+constexpr UnrollPolicy<MAX_FULL_UNROLL, BLOCK_SIZE> unrollPolicy = {};
+
+/**
+ * @brief Reasonable default: fully unroll up to 64 iterations, unroll longer loops by 8.
+ */
+using DefaultUnrollPolicy = UnrollPolicy<64, 8>;
+
+namespace detail
+{
+
+template<typename UnaryFunc, typename Index, size_t LANE>
+constexpr void callLoopBody(UnaryFunc& func, const Index i, const Fixed<size_t, LANE> lane)
+{
+	if constexpr (std::invocable<UnaryFunc&, Index, Fixed<size_t, LANE>>) { func(i, lane); }
+	else                                                                  { func(i); }
+}
+
+template<size_t BLOCK_SIZE, std::integral Size, Size FIRST, Size STEP, typename UnaryFunc, size_t... Ks>
+constexpr void unrolledRange(UnaryFunc& func, std::index_sequence<Ks...>)
+{
+	(callLoopBody(func, fixed<Size, seqValue<Size, FIRST, STEP>(Ks)>, fixed<size_t, Ks % BLOCK_SIZE>), ...);
+}
+
+template<std::integral Size, Size FIRST, Size STEP, typename UnaryFunc, size_t... Js>
+constexpr void rangeBlock(UnaryFunc& func, const size_t k, std::index_sequence<Js...>)
+{
+	(callLoopBody(func, seqValue<Size, FIRST, STEP>(k + Js), fixed<size_t, Js>), ...);
+}
+
+template<size_t BLOCK_SIZE, size_t OFFSET, typename T, T... VALUES, typename UnaryFunc, size_t... Ks>
+constexpr void unrolledArray(UnaryFunc& func, std::index_sequence<Ks...>)
+{
+	(callLoopBody(func, fixed<T, FixedArray<T, VALUES...>::values[OFFSET + Ks]>, fixed<size_t, (OFFSET + Ks) % BLOCK_SIZE>), ...);
+}
+
+template<typename T, T... VALUES, typename UnaryFunc, size_t... Js>
+constexpr void arrayBlock(UnaryFunc& func, const size_t k, std::index_sequence<Js...>)
+{
+	(callLoopBody(func, FixedArray<T, VALUES...>::values[k + Js], fixed<size_t, Js>), ...);
+}
+
+} // namespace detail
+
+/**
+ * @brief Iterate over `[FIRST, BOUND)` with stride `STEP`, unrolling according to an `UnrollPolicy`.
+ */
+template<size_t MAX_FULL_UNROLL, size_t BLOCK_SIZE, std::integral Size, Size FIRST, Size BOUND, Size STEP, typename UnaryFunc> 
+constexpr UnaryFunc&& foreach(UnrollPolicy<MAX_FULL_UNROLL, BLOCK_SIZE>, Fixed<Size, FIRST>, Fixed<Size, BOUND>, Fixed<Size, STEP>, UnaryFunc&& func)
+{
+	constexpr size_t COUNT = detail::seqSize<Size, FIRST, BOUND, STEP>();
+
+	if constexpr (COUNT <= MAX_FULL_UNROLL)
+	{
+		detail::unrolledRange<BLOCK_SIZE, Size, FIRST, STEP>(func, std::make_index_sequence<COUNT>{});
+	}
+	else
+	{
+		constexpr size_t BULK = COUNT - COUNT % BLOCK_SIZE;
+
+		for (size_t k = 0; k != BULK; k += BLOCK_SIZE)
+		{
+			detail::rangeBlock<Size, FIRST, STEP>(func, k, std::make_index_sequence<BLOCK_SIZE>{});
+		}
+		detail::unrolledRange<BLOCK_SIZE, Size, detail::seqValue<Size, FIRST, STEP>(BULK), STEP>(func, std::make_index_sequence<COUNT - BULK>{});
+	}
+	return std::forward<UnaryFunc>(func);
+}
+
+/**
+ * @brief Iterate over `[FIRST, BOUND)`, unrolling according to an `UnrollPolicy`.
+ */
+template<size_t MAX_FULL_UNROLL, size_t BLOCK_SIZE, std::integral Size, Size FIRST, Size BOUND, typename UnaryFunc> 
+constexpr UnaryFunc&& foreach(const UnrollPolicy<MAX_FULL_UNROLL, BLOCK_SIZE> policy, const Fixed<Size, FIRST> first, const Fixed<Size, BOUND> bound, UnaryFunc&& func) 
+{ 
+	return foreach(policy, first, bound, fixed<Size, 1>, std::forward<UnaryFunc>(func)); 
+}
+
+/**
+ * @brief Iterate over the elements of a FixedArray, unrolling according to an `UnrollPolicy`.
+ *
+ * In the looping regime, the elements are read from `FixedArray::values`.
+ */
+template<size_t MAX_FULL_UNROLL, size_t BLOCK_SIZE, typename T, T... VALUES, typename UnaryFunc> 
+constexpr UnaryFunc&& foreach(UnrollPolicy<MAX_FULL_UNROLL, BLOCK_SIZE>, FixedArray<T, VALUES...>, UnaryFunc&& func)
+{
+	constexpr size_t COUNT = sizeof...(VALUES);
+
+	if constexpr (COUNT <= MAX_FULL_UNROLL)
+	{
+		detail::unrolledArray<BLOCK_SIZE, 0, T, VALUES...>(func, std::make_index_sequence<COUNT>{});
+	}
+	else
+	{
+		constexpr size_t BULK = COUNT - COUNT % BLOCK_SIZE;
+
+		for (size_t k = 0; k != BULK; k += BLOCK_SIZE)
+		{
+			detail::arrayBlock<T, VALUES...>(func, k, std::make_index_sequence<BLOCK_SIZE>{});
+		}
+		detail::unrolledArray<BLOCK_SIZE, BULK, T, VALUES...>(func, std::make_index_sequence<COUNT - BULK>{});
+	}
+	return std::forward<UnaryFunc>(func);
+}
+
+// ============================================================================
+// Tiled loops
+// ============================================================================
+
+/**
+ * @brief Split the range `[begin, end)` into tiles of `TILE` elements plus a remainder.
+ *
+ * @param begin First index, a runtime value or a `Fixed`.
+ * @param end   Bound of the range, a runtime value or a `Fixed`; the range is empty when it does not exceed `begin`.
+ * @param tile  Length of the tiles.
+ * @param func  Called as `func(i, length)` once per tile, then once for the tail.
+ *
+ * Every tile is reported with a `Fixed<size_t, TILE>` length, so that the
+ * inner loop of `func` has a compile-time trip count and can be fully
+ * vectorised without remainder handling. The tail, when not empty, is
+ * reported with a runtime `size_t` length, or with a `Fixed` length when both
+ * `begin` and `end` are `Fixed`.
+ *
+ * Example:
+ * @code
+ * BIC::foreachTiled(size_t(0), n, BIC::fixed<size_t, 8>, [&](const size_t i, const auto length)
+ * {
+ *     axpy(alpha, x + i, length, y + i);
+ * });
+ * @endcode
+ */
+template<typename Begin, typename End, size_t TILE, typename TileFunc>
+constexpr TileFunc&& foreachTiled(const Begin begin, const End end, const Fixed<size_t, TILE> tile, TileFunc&& func)
+{
+	static_assert(TILE > 0, "BIC::foreachTiled: the tile length must be positive");
+
+	using Index = std::common_type_t<Mutable<Begin>, Mutable<End>>;
+
+	// A range whose end precedes its beginning is empty, as for a plain for loop
+	Index i = begin;
+	for (; i < static_cast<Index>(end) and static_cast<size_t>(end - i) >= TILE; i += static_cast<Index>(TILE)) { func(i, tile); }
+
+	if constexpr (IsFixed<Begin>::value and IsFixed<End>::value)
+	{
+		constexpr size_t TAIL = static_cast<Index>(Begin::value) < static_cast<Index>(End::value) ? static_cast<size_t>(End::value - Begin::value) % TILE : 0;
+
+		if constexpr (TAIL != 0) { func(i, fixed<size_t, TAIL>); }
+	}
+	else
+	{
+		if (i < static_cast<Index>(end)) { func(i, static_cast<size_t>(end - i)); }
+	}
+	return std::forward<TileFunc>(func);
+}
+
+/**
+ * @brief Split the range `[begin, end)` into tiles of `TILE` elements plus a remainder matched against `tailLengths`.
+ *
+ * Same as `foreachTiled(begin, end, tile, func)`, except that the length of
+ * the tail is dispatched over `tailLengths`: it is reported as a `Fixed` when
+ * it is one of them and as a runtime `size_t` otherwise.
+ *
+ * Example:
+ * @code
+ * // the tail length is always a Fixed
+ * BIC::foreachTiled(size_t(0), n, BIC::fixed<size_t, 8>, BIC::seq<size_t, 1, 8>, body);
+ * @endcode
+ */
+template<typename Begin, typename End, size_t TILE, size_t... TAILS, typename TileFunc>
+constexpr TileFunc&& foreachTiled(const Begin begin, const End end, const Fixed<size_t, TILE> tile, const FixedArray<size_t, TAILS...> tailLengths, TileFunc&& func)
+{
+	static_assert(TILE > 0, "BIC::foreachTiled: the tile length must be positive");
+
+	using Index = std::common_type_t<Mutable<Begin>, Mutable<End>>;
+
+	// A range whose end precedes its beginning is empty, as for a plain for loop
+	Index i = begin;
+	for (; i < static_cast<Index>(end) and static_cast<size_t>(end - i) >= TILE; i += static_cast<Index>(TILE)) { func(i, tile); }
+
+	if (i < static_cast<Index>(end)) { dispatch(static_cast<size_t>(end - i), tailLengths, [&](const auto length) { func(i, length); }); }
+
+	return std::forward<TileFunc>(func);
+}
 	
 } // namespace BIC
 
@@ -0,0 +1,336 @@
+#ifndef BIC_LOOPS_ND_HPP
+#define BIC_LOOPS_ND_HPP
+
+/**
+ * @file LoopsND.hpp
+ * @brief Loop nests over a cartesian product of `FixedArray`s and `Fixed` or runtime ranges.
+ * @date 2025
+ * @version 1.0
+ *
+ * `BIC::foreachND` runs the loop nest over a cartesian product of dimensions
+ * and calls its body with one index per dimension. Each dimension is
+ *  - a `FixedArray` or a `Range` whose ends are both `Fixed`: the loop is
+ *    fully unrolled and the index is a `Fixed`,
+ *  - a `Range` with a runtime end: the loop is a real loop.
+ *
+ * The nesting order of the loops is a compile-time permutation, `loopOrder`,
+ * so loops are interchanged without rewriting the nest, and ranges may be
+ * blocked (tiled) with compile-time block sizes, `loopBlocks`: the loops over
+ * the blocks, in loop order, enclose the loops within a block, in loop order.
+ * The body always receives the indices in dimension order.
+ *
+ * Example:
+ * @code
+ * // c[i][j] += a[i][k] * b[k][j], with the i, k, j order and 64x64 blocks on i and j
+ * BIC::foreachND(BIC::loopOrder<0, 2, 1>, BIC::loopBlocks<64, 64, 0>, BIC::cartesian(m, n, p), [&](const size_t i, const size_t j, const size_t k)
+ * {
+ *     c[i*n + j] += a[i*p + k]*b[k*n + j];
+ * });
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedArray.hpp>
+#include <BIC/Integer.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Loops.hpp>
+#include <BIC/Mutable.hpp>
+#include <BIC/Shape.hpp>
+#include <BIC/Stored.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace BIC
+{
+
+/**
+ * @brief Half-open range `[first, bound)` whose ends are each a `Fixed` or a runtime integer.
+ */
+template<typename First, typename Bound>
+struct Range
+{
+	static_assert(std::integral<Mutable<First>> and std::integral<Mutable<Bound>>, "BIC::Range: the ends of a range are integers");
+
+	using Index = std::common_type_t<Mutable<First>, Mutable<Bound>>; ///< @brief Type of the runtime indices.
+
+	static constexpr bool IS_FIXED = IsFixed<First>::value and IsFixed<Bound>::value; ///< @brief Whether the loop over the range is unrolled.
+
+	BIC_NO_UNIQUE_ADDRESS First first; ///< @brief First index.
+	BIC_NO_UNIQUE_ADDRESS Bound bound; ///< @brief Bound of the range, excluded.
+};
+
+/**
+ * @brief Range `[first, bound)`.
+ */
+template<typename First, typename Bound> requires std::integral<Mutable<First>> and std::integral<Mutable<Bound>>
+constexpr Range<First, Bound> range(const First first, const Bound bound) { return {first, bound}; }
+
+/**
+ * @brief Range `[0, bound)`, starting at a `Fixed` 0.
+ */
+template<typename Bound> requires std::integral<Mutable<Bound>>
+constexpr Range<Fixed<Mutable<Bound>, 0>, Bound> range(const Bound bound) { return {{}, bound}; }
+
+/**
+ * @brief Nesting order of the loops of `foreachND`, from the outermost to the innermost loop.
+ *
+ * @tparam ORDER Permutation of the dimensions: `ORDER[l]` is the dimension iterated by the `l`-th loop.
+ */
+template<size_t... ORDER>
+struct LoopOrder
+{
+	static constexpr std::array<size_t, sizeof...(ORDER)> order = {ORDER...}; ///< @brief Dimension of each loop.
+
+	/// Loop of each dimension, the inverse permutation.
+	static constexpr std::array<size_t, sizeof...(ORDER)> loops = []
+	{
+		std::array<size_t, sizeof...(ORDER)> loops = {};
+		for (size_t l = 0; l != sizeof...(ORDER); ++l) { loops[order[l]] = l; }
+		return loops;
+	}();
+
+	static_assert([]
+	{
+		std::array<bool, sizeof...(ORDER)> seen = {};
+		for (const size_t d : order) { if (d >= sizeof...(ORDER) or seen[d]) { return false; } seen[d] = true; }
+		return true;
+	}(), "BIC::LoopOrder: the loop order must be a permutation of the dimensions");
+};
+
+/**
+ * @brief Global constexpr instance of `LoopOrder`.
+ */
+template<size_t... ORDER>
+constexpr LoopOrder<ORDER...> loopOrder = {};
+
+/**
+ * @brief Block sizes of the dimensions of `foreachND`, 0 or 1 for a dimension that is not blocked.
+ */
+template<size_t... BLOCKS>
+struct LoopBlocks
+{
+	static constexpr std::array<size_t, sizeof...(BLOCKS)> blocks = {BLOCKS...}; ///< @brief Block size of each dimension.
+};
+
+/**
+ * @brief Global constexpr instance of `LoopBlocks`.
+ */
+template<size_t... BLOCKS>
+constexpr LoopBlocks<BLOCKS...> loopBlocks = {};
+
+namespace detail
+{
+
+/// `dim` as a dimension of a cartesian product: an integer or a `Fixed` integer `n` is the range `[0, n)`.
+template<typename Dim>
+constexpr auto toDimension(const Dim dim)
+{
+	if constexpr (std::integral<Mutable<Dim>>) { return range(dim); }
+	else                                       { return dim; }
+}
+
+template<typename Dim> struct IsRange : std::false_type {};
+
+template<typename First, typename Bound> struct IsRange<Range<First, Bound>> : std::true_type {};
+
+template<typename Dim> struct IsDimension : IsRange<Dim> {};
+
+template<typename T, T... VALUES> struct IsDimension<FixedArray<T, VALUES...>> : std::true_type {};
+
+} // namespace detail
+
+/**
+ * @brief Cartesian product of dimensions, each one a `FixedArray` or a `Range`.
+ */
+template<typename... Dims>
+struct Cartesian
+{
+	static_assert((detail::IsDimension<Dims>::value and ...), "BIC::Cartesian: every dimension is a FixedArray or a Range");
+
+	static constexpr size_t RANK = sizeof...(Dims); ///< @brief Number of dimensions.
+
+	std::tuple<Dims...> dims; ///< @brief The dimensions.
+};
+
+/**
+ * @brief Cartesian product of `dims`, each one a `FixedArray`, a `Range`, or an integer or `Fixed` integer `n` for `[0, n)`.
+ */
+template<typename... Dims>
+constexpr auto cartesian(const Dims... dims) { return Cartesian<decltype(detail::toDimension(dims))...>{{detail::toDimension(dims)...}}; }
+
+template<typename... Dims>
+constexpr Cartesian<Dims...> cartesian(const Cartesian<Dims...>& product) { return product; }
+
+/**
+ * @brief Cartesian product of the ranges `[0, extent)` of the dimensions of a `Shape`.
+ */
+template<typename... Extents>
+constexpr auto cartesian(const Shape<Extents...>& shape)
+{
+	return [&]<size_t... Ds>(std::index_sequence<Ds...>) { return cartesian(shape.template extent<Ds>()...); }(std::index_sequence_for<Extents...>{});
+}
+
+namespace detail
+{
+
+/**
+ * @brief Calls `func(i)` for every index `i` of `dim`, unrolled when the dimension is known at compile time.
+ */
+template<typename Dim, typename UnaryFunc>
+constexpr void loopOver(const Dim& dim, UnaryFunc&& func)
+{
+	if constexpr (not IsRange<Dim>::value)
+	{
+		foreach(dim, func);
+	}
+	else if constexpr (Dim::IS_FIXED)
+	{
+		using Index = typename Dim::Index;
+		foreach(fixed<Index, static_cast<Index>(decltype(dim.first)::value)>, fixed<Index, static_cast<Index>(decltype(dim.bound)::value)>, func);
+	}
+	else
+	{
+		using Index = typename Dim::Index;
+		for (Index i = static_cast<Index>(dim.first); i < static_cast<Index>(dim.bound); ++i) { func(i); }
+	}
+}
+
+/**
+ * @brief Calls `func(block)` for every block of `BLOCK` indices of `range`, the last one being possibly shorter.
+ *
+ * The blocks are `Range`s, of `Fixed` ends when those of `range` are.
+ */
+template<size_t BLOCK, typename First, typename Bound, typename UnaryFunc>
+constexpr void loopOverBlocks(const Range<First, Bound>& range, UnaryFunc&& func)
+{
+	using Index = typename Range<First, Bound>::Index;
+
+	constexpr Fixed<Index, static_cast<Index>(BLOCK)> block = {};
+
+	if constexpr (Range<First, Bound>::IS_FIXED)
+	{
+		foreach(fixed<Index, static_cast<Index>(First::value)>, fixed<Index, static_cast<Index>(Bound::value)>, block, [&](const auto first)
+		{
+			func(BIC::range(first, BIC::min(first + block, fixed<Index, static_cast<Index>(Bound::value)>)));
+		});
+	}
+	else
+	{
+		for (Index first = static_cast<Index>(range.first); first < static_cast<Index>(range.bound); first += block)
+		{
+			func(BIC::range(first, BIC::min(static_cast<Index>(first + block), static_cast<Index>(range.bound))));
+		}
+	}
+}
+
+/// `dims` whose `D`-th element is replaced by `dim`.
+template<size_t D, typename... Dims, typename Dim, size_t... Ds>
+constexpr auto replaceDimension(const std::tuple<Dims...>& dims, const Dim& dim, std::index_sequence<Ds...>)
+{
+	return std::tuple<std::conditional_t<Ds == D, Dim, Dims>...>([&]() -> decltype(auto)
+	{
+		if constexpr (Ds == D) { return dim; }
+		else                   { return std::get<Ds>(dims); }
+	}()...);
+}
+
+/**
+ * @brief Loops `L...` of the nest, calling `func` in dimension order with the loop indices `indices...` once they are all known.
+ */
+template<size_t L, size_t... ORDER, typename... Dims, typename Func, typename... Indices>
+constexpr void loopNest(const LoopOrder<ORDER...> order, const std::tuple<Dims...>& dims, Func& func, const Indices... indices)
+{
+	if constexpr (L == sizeof...(ORDER))
+	{
+		const std::tuple<Indices...> loopIndices(indices...);
+		[&]<size_t... Ds>(std::index_sequence<Ds...>) { func(std::get<LoopOrder<ORDER...>::loops[Ds]>(loopIndices)...); }(std::index_sequence_for<Dims...>{});
+	}
+	else
+	{
+		loopOver(std::get<LoopOrder<ORDER...>::order[L]>(dims), [&](const auto i) { loopNest<L + 1>(order, dims, func, indices..., i); });
+	}
+}
+
+/**
+ * @brief Loops over the blocks of the dimensions `ORDER[L]...`, then the loop nest within the blocks.
+ */
+template<size_t L, size_t... ORDER, size_t... BLOCKS, typename... Dims, typename Func>
+constexpr void blockedLoopNest(const LoopOrder<ORDER...> order, const LoopBlocks<BLOCKS...> blocks, const std::tuple<Dims...>& dims, Func& func)
+{
+	if constexpr (L == sizeof...(ORDER))
+	{
+		loopNest<0>(order, dims, func);
+	}
+	else
+	{
+		constexpr size_t D     = LoopOrder<ORDER...>::order[L];
+		constexpr size_t BLOCK = LoopBlocks<BLOCKS...>::blocks[D];
+
+		if constexpr (BLOCK <= 1) { blockedLoopNest<L + 1>(order, blocks, dims, func); }
+		else
+		{
+			static_assert(IsRange<std::tuple_element_t<D, std::tuple<Dims...>>>::value, "BIC::foreachND: only ranges may be blocked");
+
+			loopOverBlocks<BLOCK>(std::get<D>(dims), [&](const auto block)
+			{
+				blockedLoopNest<L + 1>(order, blocks, replaceDimension<D>(dims, block, std::index_sequence_for<Dims...>{}), func);
+			});
+		}
+	}
+}
+
+} // namespace detail
+
+/**
+ * @brief Run the loop nest over `dims`, the loops being nested in the order `ORDER` and the dimensions blocked by `BLOCKS`.
+ *
+ * @param order  Nesting order of the loops, a permutation of the dimensions.
+ * @param blocks Block size of each dimension, 0 or 1 when it is not blocked; only `Range`s may be blocked.
+ * @param dims   The dimensions, a `Cartesian` or a `Shape`.
+ * @param func   Called as `func(i0, i1, ...)` with one index per dimension, in dimension order.
+ */
+template<size_t... ORDER, size_t... BLOCKS, typename Dims, typename Func>
+constexpr Func&& foreachND(const LoopOrder<ORDER...> order, const LoopBlocks<BLOCKS...> blocks, const Dims& dims, Func&& func)
+{
+	const auto product = cartesian(dims);
+
+	static_assert(sizeof...(ORDER) == decltype(product)::RANK, "BIC::foreachND: the loop order gives one loop per dimension");
+	static_assert(sizeof...(BLOCKS) == decltype(product)::RANK, "BIC::foreachND: one block size per dimension");
+
+	detail::blockedLoopNest<0>(order, blocks, product.dims, func);
+	return std::forward<Func>(func);
+}
+
+/**
+ * @brief Run the loop nest over `dims`, the loops being nested in the order `ORDER`.
+ */
+template<size_t... ORDER, typename Dims, typename Func>
+constexpr Func&& foreachND(const LoopOrder<ORDER...> order, const Dims& dims, Func&& func)
+{
+	const auto product = cartesian(dims);
+
+	static_assert(sizeof...(ORDER) == decltype(product)::RANK, "BIC::foreachND: the loop order gives one loop per dimension");
+
+	detail::loopNest<0>(order, product.dims, func);
+	return std::forward<Func>(func);
+}
+
+/**
+ * @brief Run the loop nest over `dims`, the first dimension being the outermost loop.
+ */
+template<typename Dims, typename Func>
+constexpr Func&& foreachND(const Dims& dims, Func&& func)
+{
+	const auto product = cartesian(dims);
+
+	return [&]<size_t... Ls>(std::index_sequence<Ls...>) -> Func&& { return foreachND(loopOrder<Ls...>, product, std::forward<Func>(func)); }(std::make_index_sequence<decltype(product)::RANK>{});
+}
+
+} // namespace BIC
+
+#endif // BIC_LOOPS_ND_HPP
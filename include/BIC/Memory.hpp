@@ -0,0 +1,390 @@
+#ifndef BIC_MEMORY_HPP
+#define BIC_MEMORY_HPP
+
+/**
+ * @file Memory.hpp
+ * @brief Copy, fill, compare and swap ranges whose length may be a `Fixed`.
+ * @date 2025
+ * @version 1.0
+ *
+ * With a `Fixed` length, the operations on trivially copyable elements are
+ * expanded into a fixed sequence of the widest moves fitting the range. A
+ * length that is not a multiple of the move width is covered by one last move
+ * overlapping the previous one, so 7 bytes are copied with two 4-byte moves
+ * and 24 bytes with two 16-byte moves. Comparisons XOR the words of both
+ * ranges, OR the differences together and test the combined mask once.
+ * Fixed lengths up to `MEMORY_MAX_UNROLL` bytes are fully unrolled, longer
+ * ones loop over unrolled blocks. No call to `memcpy`, `memset` or `memcmp`
+ * is emitted.
+ *
+ * With a runtime length, the same moves are used in a loop, followed by at
+ * most two overlapping moves for the remainder.
+ *
+ * As with `memcpy`, the ranges given to `copy`, `equal` and `swapRanges`
+ * must not overlap.
+ *
+ * Example:
+ * @code
+ * BIC::copy(header, packet, BIC::fixed<size_t, sizeof(Header)>);    // 3 moves for a 40-byte header
+ * if (BIC::equal(key, expected, BIC::fixed<size_t, 24>)) { ... }    // 3 XOR, 2 OR and a single test
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Loops.hpp>
+#include <BIC/Seq.hpp>
+
+#include <bit>         // for std::has_single_bit
+#include <cstddef>
+#include <cstdint>
+#include <cstring>     // for std::memcpy
+#include <type_traits>
+#include <utility>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/// @brief Widest single move, in bytes: a vector register of the target.
+#if defined(__AVX__)
+inline constexpr size_t MEMORY_MAX_MOVE = 32;
+#else
+inline constexpr size_t MEMORY_MAX_MOVE = 16;
+#endif
+
+inline constexpr size_t MEMORY_MAX_UNROLL = 256; ///< @brief Longest fully unrolled range, in bytes.
+
+/**
+ * @brief Moves exactly `BYTES` bytes. With a constant size the builtin is always expanded inline.
+ */
+template<size_t BYTES>
+inline void moveBytes(void* const dst, const void* const src)
+{
+#if defined(__GNUC__)
+	__builtin_memcpy(dst, src, BYTES);
+#else
+	std::memcpy(dst, src, BYTES);
+#endif
+}
+
+/**
+ * @brief Widest power of two not greater than `bytes` nor than `limit`.
+ */
+constexpr size_t moveWidth(const size_t bytes, const size_t limit)
+{
+	size_t width = 1;
+	while (2*width <= bytes and 2*width <= limit) { width *= 2; }
+	return width;
+}
+
+/**
+ * @brief Moves the words `Ks` of `WIDTH` bytes, a fold rather than a `foreach` so that long sequences stay inlined.
+ */
+template<size_t WIDTH, size_t... Ks>
+inline void moveWords(unsigned char* const dst, const unsigned char* const src, std::index_sequence<Ks...>)
+{
+	(moveBytes<WIDTH>(dst + Ks*WIDTH, src + Ks*WIDTH), ...);
+}
+
+template<size_t BYTES>
+inline void copyBytes(unsigned char* const dst, const unsigned char* const src)
+{
+	if constexpr (BYTES != 0 and BYTES <= MEMORY_MAX_UNROLL)
+	{
+		constexpr size_t WIDTH = moveWidth(BYTES, MEMORY_MAX_MOVE);
+
+		moveWords<WIDTH>(dst, src, std::make_index_sequence<BYTES / WIDTH>{});
+
+		if constexpr (BYTES % WIDTH != 0) { moveBytes<WIDTH>(dst + (BYTES - WIDTH), src + (BYTES - WIDTH)); }
+	}
+	else if constexpr (BYTES > MEMORY_MAX_UNROLL)
+	{
+		for (size_t i = 0; i != BYTES / MEMORY_MAX_UNROLL; ++i) { copyBytes<MEMORY_MAX_UNROLL>(dst + i*MEMORY_MAX_UNROLL, src + i*MEMORY_MAX_UNROLL); }
+
+		if constexpr (BYTES % MEMORY_MAX_UNROLL != 0) { copyBytes<MEMORY_MAX_UNROLL>(dst + (BYTES - MEMORY_MAX_UNROLL), src + (BYTES - MEMORY_MAX_UNROLL)); }
+	}
+}
+
+/**
+ * @brief Copies `bytes` bytes with moves of `WIDTH` bytes or less, the last two possibly overlapping.
+ */
+template<size_t WIDTH = MEMORY_MAX_MOVE>
+inline void copyBytes(unsigned char* const dst, const unsigned char* const src, const size_t bytes)
+{
+	if constexpr (WIDTH == 1)
+	{
+		if (bytes != 0) { moveBytes<1>(dst, src); }
+	}
+	else if (bytes >= WIDTH)
+	{
+		size_t i = 0;
+		for (; i + WIDTH <= bytes; i += WIDTH) { moveBytes<WIDTH>(dst + i, src + i); }
+		if (i != bytes) { moveBytes<WIDTH>(dst + (bytes - WIDTH), src + (bytes - WIDTH)); }
+	}
+	else if (bytes >= WIDTH/2)
+	{
+		moveBytes<WIDTH/2>(dst, src);
+		moveBytes<WIDTH/2>(dst + (bytes - WIDTH/2), src + (bytes - WIDTH/2));
+	}
+	else
+	{
+		copyBytes<WIDTH/2>(dst, src, bytes);
+	}
+}
+
+template<typename Word>
+inline Word loadWord(const unsigned char* const p)
+{
+	Word word;
+	moveBytes<sizeof(Word)>(&word, p);
+	return word;
+}
+
+/**
+ * @brief Unsigned integer of `BYTES` bytes, `BYTES` being 1, 2, 4 or 8.
+ */
+template<size_t BYTES>
+using Word = std::conditional_t<BYTES == 1, std::uint8_t, std::conditional_t<BYTES == 2, std::uint16_t, std::conditional_t<BYTES == 4, std::uint32_t, std::uint64_t>>>;
+
+/**
+ * @brief OR of the XOR of the words `Ks` of `WIDTH` bytes of `a` and `b`.
+ */
+template<size_t WIDTH, size_t... Ks>
+inline Word<WIDTH> wordsDifference(const unsigned char* const a, const unsigned char* const b, std::index_sequence<Ks...>)
+{
+	using W = Word<WIDTH>;
+
+	return static_cast<W>((W(0) | ... | static_cast<W>(loadWord<W>(a + Ks*WIDTH) ^ loadWord<W>(b + Ks*WIDTH))));
+}
+
+template<size_t BYTES>
+inline bool equalBytes(const unsigned char* const a, const unsigned char* const b)
+{
+	if constexpr (BYTES == 0)
+	{
+		return true;
+	}
+	else if constexpr (BYTES <= MEMORY_MAX_UNROLL)
+	{
+		constexpr size_t WIDTH = moveWidth(BYTES, sizeof(std::uint64_t));
+
+		using W = Word<WIDTH>;
+
+		W difference = wordsDifference<WIDTH>(a, b, std::make_index_sequence<BYTES / WIDTH>{});
+
+		if constexpr (BYTES % WIDTH != 0) { difference |= static_cast<W>(loadWord<W>(a + (BYTES - WIDTH)) ^ loadWord<W>(b + (BYTES - WIDTH))); }
+
+		return difference == 0;
+	}
+	else
+	{
+		for (size_t i = 0; i != BYTES / MEMORY_MAX_UNROLL; ++i)
+		{
+			if (not equalBytes<MEMORY_MAX_UNROLL>(a + i*MEMORY_MAX_UNROLL, b + i*MEMORY_MAX_UNROLL)) { return false; }
+		}
+		return equalBytes<BYTES % MEMORY_MAX_UNROLL>(a + (BYTES - BYTES % MEMORY_MAX_UNROLL), b + (BYTES - BYTES % MEMORY_MAX_UNROLL));
+	}
+}
+
+template<size_t WIDTH = sizeof(std::uint64_t)>
+inline bool equalBytes(const unsigned char* const a, const unsigned char* const b, const size_t bytes)
+{
+	using W = Word<WIDTH>;
+
+	if constexpr (WIDTH == 1)
+	{
+		return bytes == 0 or loadWord<W>(a) == loadWord<W>(b);
+	}
+	else if (bytes >= WIDTH)
+	{
+		size_t i = 0;
+		for (; i + WIDTH <= bytes; i += WIDTH)
+		{
+			if (loadWord<W>(a + i) != loadWord<W>(b + i)) { return false; }
+		}
+		return i == bytes or loadWord<W>(a + (bytes - WIDTH)) == loadWord<W>(b + (bytes - WIDTH));
+	}
+	else
+	{
+		return equalBytes<WIDTH/2>(a, b, bytes);
+	}
+}
+
+/**
+ * @brief Elements whose bytes can be moved with `memcpy`.
+ */
+template<typename T>
+inline constexpr bool MEMORY_BYTEWISE_COPY = std::is_trivially_copyable_v<T>;
+
+/**
+ * @brief Elements equal if and only if their bytes are, e.g. integers but not floating-point numbers.
+ */
+template<typename T>
+inline constexpr bool MEMORY_BYTEWISE_EQUAL = std::has_unique_object_representations_v<T>;
+
+/**
+ * @brief Elements whose fill pattern is a whole number of elements in every move.
+ */
+template<typename T>
+inline constexpr bool MEMORY_BYTEWISE_FILL = std::is_trivially_copyable_v<T> and std::has_single_bit(sizeof(T)) and sizeof(T) <= MEMORY_MAX_MOVE;
+
+} // namespace detail
+
+/**
+ * @brief Copies the `n` elements of `src` to `dst`.
+ *
+ * @param dst Destination, must not overlap `src`.
+ * @param src Source.
+ * @param n   Number of elements, a `Fixed` or a runtime value.
+ */
+template<typename T, typename Size>
+constexpr void copy(T* const dst, const T* const src, const Size n)
+{
+	if constexpr (detail::MEMORY_BYTEWISE_COPY<T>)
+	{
+		if (not std::is_constant_evaluated())
+		{
+			if constexpr (IsFixed<Size>::value) { detail::copyBytes<Size::value * sizeof(T)>(reinterpret_cast<unsigned char*>(dst), reinterpret_cast<const unsigned char*>(src)); }
+			else                                { detail::copyBytes(reinterpret_cast<unsigned char*>(dst), reinterpret_cast<const unsigned char*>(src), static_cast<size_t>(n) * sizeof(T)); }
+			return;
+		}
+	}
+
+	for (size_t i = 0; i != static_cast<size_t>(n); ++i) { dst[i] = src[i]; }
+}
+
+/**
+ * @brief Sets the `n` elements of `dst` to `value`.
+ *
+ * With a `Fixed` length, `value` is replicated once into a buffer as wide as
+ * the widest move, which is then stored with overlapping moves.
+ */
+template<typename T, typename Size>
+constexpr void fill(T* const dst, const std::type_identity_t<T>& value, const Size n)
+{
+	if constexpr (detail::MEMORY_BYTEWISE_FILL<T>)
+	{
+		if (not std::is_constant_evaluated())
+		{
+			unsigned char* const bytes = reinterpret_cast<unsigned char*>(dst);
+
+			if constexpr (IsFixed<Size>::value)
+			{
+				constexpr size_t BYTES = Size::value * sizeof(T);
+				constexpr size_t WIDTH = detail::moveWidth(BYTES, detail::MEMORY_MAX_MOVE);
+
+				if constexpr (BYTES != 0)
+				{
+					T pattern[WIDTH / sizeof(T)];
+					for (T& element : pattern) { element = value; }
+
+					for (size_t i = 0; i != BYTES / WIDTH; ++i) { detail::moveBytes<WIDTH>(bytes + i*WIDTH, pattern); }
+
+					if constexpr (BYTES % WIDTH != 0) { detail::moveBytes<WIDTH>(bytes + (BYTES - WIDTH), pattern); }
+				}
+			}
+			else
+			{
+				constexpr size_t WIDTH = detail::MEMORY_MAX_MOVE;
+
+				T pattern[WIDTH / sizeof(T)];
+				for (T& element : pattern) { element = value; }
+
+				const size_t total = static_cast<size_t>(n) * sizeof(T);
+
+				size_t i = 0;
+				for (; i + WIDTH <= total; i += WIDTH) { detail::moveBytes<WIDTH>(bytes + i, pattern); }
+				for (; i != total; i += sizeof(T))     { detail::moveBytes<sizeof(T)>(bytes + i, pattern); }
+			}
+			return;
+		}
+	}
+
+	for (size_t i = 0; i != static_cast<size_t>(n); ++i) { dst[i] = value; }
+}
+
+/**
+ * @brief Whether the `n` elements of `a` and `b` are equal.
+ *
+ * Elements with a unique object representation (integers, enumerations,
+ * structs of them without padding) are compared bytewise: with a `Fixed`
+ * length, by OR-ing the XOR of every word and testing the result once.
+ * Other elements are compared with `==` without short-circuiting.
+ */
+template<typename T, typename Size>
+constexpr bool equal(const T* const a, const T* const b, const Size n)
+{
+	if constexpr (detail::MEMORY_BYTEWISE_EQUAL<T>)
+	{
+		if (not std::is_constant_evaluated())
+		{
+			if constexpr (IsFixed<Size>::value) { return detail::equalBytes<Size::value * sizeof(T)>(reinterpret_cast<const unsigned char*>(a), reinterpret_cast<const unsigned char*>(b)); }
+			else                                { return detail::equalBytes(reinterpret_cast<const unsigned char*>(a), reinterpret_cast<const unsigned char*>(b), static_cast<size_t>(n) * sizeof(T)); }
+		}
+	}
+
+	if constexpr (IsFixed<Size>::value)
+	{
+		bool result = true;
+		foreach(indexSeq<0, Size::value>, [&](const auto i) { result &= a[i] == b[i]; });
+		return result;
+	}
+	else
+	{
+		for (size_t i = 0; i != static_cast<size_t>(n); ++i) { if (not (a[i] == b[i])) { return false; } }
+		return true;
+	}
+}
+
+/**
+ * @brief Exchanges the `n` elements of `a` with those of `b`.
+ *
+ * With a `Fixed` length, both ranges are loaded before being stored, block
+ * of `MEMORY_MAX_UNROLL` bytes by block.
+ */
+template<typename T, typename Size>
+constexpr void swapRanges(T* const a, T* const b, const Size n)
+{
+	if constexpr (IsFixed<Size>::value and detail::MEMORY_BYTEWISE_COPY<T>)
+	{
+		if (not std::is_constant_evaluated())
+		{
+			constexpr size_t BYTES = Size::value * sizeof(T);
+			constexpr size_t BLOCK = BYTES < detail::MEMORY_MAX_UNROLL ? BYTES : detail::MEMORY_MAX_UNROLL;
+
+			unsigned char* const x = reinterpret_cast<unsigned char*>(a);
+			unsigned char* const y = reinterpret_cast<unsigned char*>(b);
+
+			const auto swapBlock = [](unsigned char* const p, unsigned char* const q, const auto length)
+			{
+				unsigned char buffer[decltype(length)::value];
+				detail::copyBytes<decltype(length)::value>(buffer, p);
+				detail::copyBytes<decltype(length)::value>(p, q);
+				detail::copyBytes<decltype(length)::value>(q, buffer);
+			};
+
+			if constexpr (BLOCK != 0)
+			{
+				for (size_t i = 0; i != BYTES / BLOCK; ++i) { swapBlock(x + i*BLOCK, y + i*BLOCK, fixed<size_t, BLOCK>); }
+			}
+			if constexpr (BLOCK != 0 and BYTES % BLOCK != 0)
+			{
+				swapBlock(x + (BYTES - BYTES % BLOCK), y + (BYTES - BYTES % BLOCK), fixed<size_t, BYTES % BLOCK>);
+			}
+			return;
+		}
+	}
+
+	for (size_t i = 0; i != static_cast<size_t>(n); ++i)
+	{
+		using std::swap;
+		swap(a[i], b[i]);
+	}
+}
+
+} // namespace BIC
+
+#endif // BIC_MEMORY_HPP
@@ -0,0 +1,227 @@
+#ifndef BIC_POLYNOMIAL_HPP
+#define BIC_POLYNOMIAL_HPP
+
+/**
+ * @file Polynomial.hpp
+ * @brief Evaluation of polynomials with compile-time coefficients.
+ * @date 2025
+ * @version 1.0
+ *
+ * `BIC::polyval(x, coefficients)` evaluates `c0 + c1*x + c2*x^2 + ...` where
+ * the coefficients are the values of a `FixedArray`. The evaluation is fully
+ * unrolled at compile time: zero coefficients cost nothing, trailing zero
+ * coefficients lower the degree, and every step is a fused multiply-add when
+ * the target has a fast one.
+ *
+ * Low degree polynomials use Horner's scheme, the fewest operations. Higher
+ * degrees use Estrin's scheme, which evaluates independent sub-polynomials
+ * in a tree of depth `log2(degree)` and exposes instruction-level parallelism.
+ *
+ * `x` may be any arithmetic type, or a SIMD vector type supporting `+` and
+ * `*` with a scalar (e.g. GCC/Clang vector extensions).
+ *
+ * Example:
+ * @code
+ * // exp(x) on [-ln(2)/2, ln(2)/2]
+ * constexpr auto EXP = BIC::fixedArray<double, 1., 1., 1./2, 1./6, 1./24, 1./120, 1./720, 1./5040>;
+ * const double y = BIC::polyval(x, EXP);
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedArray.hpp>
+
+#include <array>
+#include <cmath>    // for std::fma, FP_FAST_FMA
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+inline constexpr size_t POLYVAL_ESTRIN_MIN_DEGREE = 6; ///< @brief Lowest degree evaluated with Estrin's scheme by `polyval`.
+
+/**
+ * @brief Whether `std::fma` is at least as fast as a multiplication followed by an addition for `X`.
+ */
+template<typename X>
+inline constexpr bool HAS_FAST_FMA = false
+#ifdef FP_FAST_FMAF
+	or std::same_as<X, float>
+#endif
+#ifdef FP_FAST_FMA
+	or std::same_as<X, double>
+#endif
+#ifdef FP_FAST_FMAL
+	or std::same_as<X, long double>
+#endif
+;
+
+/**
+ * @brief `a*b + c`, fused when the target has a fast FMA for `X`.
+ */
+template<typename X>
+constexpr X multiplyAdd(const X a, const X b, const X c)
+{
+	if constexpr (HAS_FAST_FMA<X>)
+	{
+		if (not std::is_constant_evaluated()) { return std::fma(a, b, c); }
+	}
+	return a*b + c;
+}
+
+/**
+ * @brief Converts the scalar `value` to `X`, broadcasting it to every lane when `X` is a vector.
+ */
+template<typename X, typename T>
+constexpr X broadcast(const T value)
+{
+	if constexpr (std::is_convertible_v<T, X>) { return static_cast<X>(value); }
+	else                                       { return X{} + value; }
+}
+
+template<typename T, T... COEFFICIENTS>
+struct PolynomialTraits
+{
+	static constexpr const std::array<T, sizeof...(COEFFICIENTS)>& C = FixedArray<T, COEFFICIENTS...>::values;
+
+	/// Number of coefficients once the trailing zeros are dropped, i.e. the degree plus one (0 for the null polynomial).
+	static constexpr size_t SIZE = []
+	{
+		size_t size = C.size();
+		while (size > 0 and C[size - 1] == T(0)) { --size; }
+		return size;
+	}();
+
+	static constexpr bool allZero(const size_t first, const size_t count)
+	{
+		for (size_t i = first; i < first + count and i < SIZE; ++i) { if (C[i] != T(0)) { return false; } }
+		return true;
+	}
+
+	/// Number of squarings of `x` needed by Estrin's scheme, the tree covers `2^LEVELS` coefficients.
+	static constexpr size_t LEVELS = []
+	{
+		size_t levels = 0;
+		while ((size_t(1) << levels) < SIZE) { ++levels; }
+		return levels;
+	}();
+};
+
+/**
+ * @brief Horner's scheme, from the highest coefficient down: `acc = acc*x + c[I]`, or `acc*x` when `c[I]` is zero.
+ */
+template<typename Traits, size_t I, typename X>
+constexpr X horner(const X x, const X acc)
+{
+	constexpr auto C = Traits::C[I];
+
+	X next;
+	if constexpr (C == 0) { next = acc*x; }
+	else                  { next = multiplyAdd(acc, x, broadcast<X>(C)); }
+
+	if constexpr (I == 0) { return next; }
+	else                  { return horner<Traits, I - 1>(x, next); }
+}
+
+/**
+ * @brief Estrin's scheme on the `2^LEVEL` coefficients starting at `FIRST`, which are not all zero.
+ *
+ * `powers[l]` holds `x^(2^l)`. The upper half is scaled by `x^(2^(LEVEL-1))`
+ * and added to the lower half; a half made of zeros only is skipped.
+ */
+template<typename Traits, size_t FIRST, size_t LEVEL, typename X, size_t LEVELS>
+constexpr X estrin(const std::array<X, LEVELS>& powers)
+{
+	if constexpr (LEVEL == 0)
+	{
+		return broadcast<X>(Traits::C[FIRST]);
+	}
+	else
+	{
+		constexpr size_t HALF = size_t(1) << (LEVEL - 1);
+
+		if constexpr (Traits::allZero(FIRST + HALF, HALF))
+		{
+			return estrin<Traits, FIRST, LEVEL - 1>(powers);
+		}
+		else if constexpr (Traits::allZero(FIRST, HALF))
+		{
+			return estrin<Traits, FIRST + HALF, LEVEL - 1>(powers) * powers[LEVEL - 1];
+		}
+		else
+		{
+			return multiplyAdd(estrin<Traits, FIRST + HALF, LEVEL - 1>(powers), powers[LEVEL - 1], estrin<Traits, FIRST, LEVEL - 1>(powers));
+		}
+	}
+}
+
+template<typename X, typename T>
+using PolyvalResult = std::remove_cvref_t<decltype(std::declval<X>() * std::declval<T>())>;
+
+} // namespace detail
+
+/**
+ * @brief Evaluates `c0 + c1*x + c2*x^2 + ...` with Horner's scheme.
+ *
+ * @param x            Scalar or SIMD vector argument.
+ * @param coefficients Coefficients, starting with the constant term.
+ * @return The value of the polynomial, of the type of `x * c0`.
+ */
+template<typename X, typename T, T... COEFFICIENTS>
+constexpr detail::PolyvalResult<X, T> polyvalHorner(const X x, const FixedArray<T, COEFFICIENTS...> /* coefficients */)
+{
+	using Result = detail::PolyvalResult<X, T>;
+	using Traits = detail::PolynomialTraits<T, COEFFICIENTS...>;
+
+	if constexpr (Traits::SIZE == 0) { return detail::broadcast<Result>(T(0)); }
+	else if constexpr (Traits::SIZE == 1) { return detail::broadcast<Result>(Traits::C[0]); }
+	else { return detail::horner<Traits, Traits::SIZE - 2>(static_cast<Result>(x), detail::broadcast<Result>(Traits::C[Traits::SIZE - 1])); }
+}
+
+/**
+ * @brief Evaluates `c0 + c1*x + c2*x^2 + ...` with Estrin's scheme.
+ *
+ * @param x            Scalar or SIMD vector argument.
+ * @param coefficients Coefficients, starting with the constant term.
+ * @return The value of the polynomial, of the type of `x * c0`.
+ */
+template<typename X, typename T, T... COEFFICIENTS>
+constexpr detail::PolyvalResult<X, T> polyvalEstrin(const X x, const FixedArray<T, COEFFICIENTS...> /* coefficients */)
+{
+	using Result = detail::PolyvalResult<X, T>;
+	using Traits = detail::PolynomialTraits<T, COEFFICIENTS...>;
+
+	if constexpr (Traits::SIZE == 0) { return detail::broadcast<Result>(T(0)); }
+	else
+	{
+		// powers[l] = x^(2^l), one spare entry keeps the array non-empty for constant polynomials
+		std::array<Result, Traits::LEVELS + 1> powers = {static_cast<Result>(x)};
+		for (size_t l = 1; l < Traits::LEVELS; ++l) { powers[l] = powers[l - 1]*powers[l - 1]; }
+
+		return detail::estrin<Traits, 0, Traits::LEVELS>(powers);
+	}
+}
+
+/**
+ * @brief Evaluates `c0 + c1*x + c2*x^2 + ...`, with Horner's scheme for low degrees and Estrin's scheme otherwise.
+ *
+ * @param x            Scalar or SIMD vector argument.
+ * @param coefficients Coefficients, starting with the constant term.
+ * @return The value of the polynomial, of the type of `x * c0`.
+ */
+template<typename X, typename T, T... COEFFICIENTS>
+constexpr detail::PolyvalResult<X, T> polyval(const X x, const FixedArray<T, COEFFICIENTS...> coefficients)
+{
+	if constexpr (detail::PolynomialTraits<T, COEFFICIENTS...>::SIZE > detail::POLYVAL_ESTRIN_MIN_DEGREE) { return polyvalEstrin(x, coefficients); }
+	else                                                                                                  { return polyvalHorner(x, coefficients); }
+}
+
+} // namespace BIC
+
+#endif // BIC_POLYNOMIAL_HPP
@@ -2,7 +2,9 @@
 #define BIC_REVERSED_HPP
 
 #include <BIC/FixedArray.hpp>
-#include <BIC/Seq.hpp>
+
+#include <algorithm> // for std::reverse
+#include <array>
 
 namespace BIC
 {
@@ -10,32 +12,18 @@ namespace BIC
 namespace detail
 {
 
-template<size_t I, typename T, T... VALUES> struct IthValue;
-
-template<size_t I, typename T, T FIRST_VALUE, T... OTHER_VALUES> requires(I==0)
-struct IthValue<I,T,FIRST_VALUE,OTHER_VALUES...>
-{
-    static constexpr T value = FIRST_VALUE;
-};
-
-template<size_t I, typename T, T FIRST_VALUE, T... OTHER_VALUES> requires(I!=0)
-struct IthValue<I,T,FIRST_VALUE,OTHER_VALUES...>
-{
-    static constexpr T value = IthValue<I-1, T, OTHER_VALUES...>::value;
-};
-
-template<typename Indices, typename T, T... VALUES> struct ReversedHelper;
-
-template<typename T, T... VALUES, size_t... Is>
-struct ReversedHelper<FixedIndices<Is...>, T, VALUES...>
+template<typename T, T... VALUES>
+constexpr std::array<T, sizeof...(VALUES)> reversedValues()
 {
-    using Type = FixedArray<T, (IthValue<sizeof...(VALUES) - 1 - Is, T, VALUES...>::value)...>;
-};
+	std::array<T, sizeof...(VALUES)> values = {VALUES...};
+	std::reverse(values.begin(), values.end());
+	return values;
+}
 
 } // namespace detail
 
 template<typename T, T... VALUES>
-using Reversed = detail::ReversedHelper<Seq<size_t, 0, sizeof...(VALUES)>, T, VALUES...>::Type;
+using Reversed = typename detail::FixedArrayFromArray<detail::reversedValues<T, VALUES...>()>::Type;
 
 template<typename T, T... VALUES>
 constexpr Reversed<T, VALUES...> reversed(FixedArray<T, VALUES...>) { return {}; } 
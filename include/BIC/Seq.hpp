@@ -3,42 +3,95 @@
 
 #include <BIC/FixedArray.hpp>
 
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
 namespace BIC
 {
 
 namespace detail
 {
-    
-template<typename T, T start, T stop, T step, T... values> struct SeqHelper;
 
-template<typename T, T start, T stop, T step, T... values> requires(step > 0 and start + step < stop)
-struct SeqHelper<T, start, stop, step, values...>
+/**
+ * @brief Number of elements of the sequence starting at `start`, incremented by `step`, and stopping before `stop`.
+ *
+ * Integral sequences use a closed form, other scalar types (e.g. floating
+ * point) replay the accumulation `start, start + step, ...` so that rounding
+ * is the same as when the elements are generated.
+ */
+template<typename T, T start, T stop, T step>
+constexpr size_t seqSize()
 {
-    using Type = typename SeqHelper<T, start + step, stop, step, values..., start>::Type;
-};
+	static_assert(start == stop or step != T(0), "BIC::Seq: the step of a non empty sequence must not be zero");
 
-template<typename T, T start, T stop, T step, T... values> requires(step < 0 and start + step > stop)
-struct SeqHelper<T, start, stop, step, values...>
+	if constexpr (start == stop)
+	{
+		return 0;
+	}
+	else if constexpr (std::integral<T>)
+	{
+		using Wide = unsigned long long;
+
+		if constexpr (step > 0) { return start < stop ? static_cast<size_t>((static_cast<Wide>(stop) - static_cast<Wide>(start) - 1)/static_cast<Wide>(step) + 1) : 0; }
+		else                    { return start > stop ? static_cast<size_t>((static_cast<Wide>(start) - static_cast<Wide>(stop) - 1)/(Wide(0) - static_cast<Wide>(step)) + 1) : 0; }
+	}
+	else
+	{
+		size_t size = 0;
+		if constexpr (step > 0) { for (T value = start; value < stop; value = value + step) { ++size; } }
+		else                    { for (T value = start; value > stop; value = value + step) { ++size; } }
+		return size;
+	}
+}
+
+/**
+ * @brief `i`-th element of an integral sequence, `start + i*step`, computed without signed overflow.
+ */
+template<std::integral T, T start, T step>
+constexpr T seqValue(const size_t i)
 {
-    using Type = typename SeqHelper<T, start + step, stop, step, values..., start>::Type;
-};
+	using Wide = unsigned long long;
+
+	return static_cast<T>(static_cast<Wide>(start) + static_cast<Wide>(i)*static_cast<Wide>(step));
+}
 
-template<typename T, T start, T stop, T step, T... values> requires(step > 0 and start < stop and start + step >= stop)
-struct SeqHelper<T, start, stop, step, values...>
+/**
+ * @brief Elements of a non-integral sequence, generated by accumulation.
+ */
+template<typename T, T start, T stop, T step>
+struct SeqValues
 {
-    using Type = FixedArray<T, values..., start>;
+	static constexpr std::array<T, seqSize<T, start, stop, step>()> values = []
+	{
+		std::array<T, seqSize<T, start, stop, step>()> result = {};
+		T value = start;
+		for (T& element : result) { element = value; value = value + step; }
+		return result;
+	}();
 };
 
-template<typename T, T start, T stop, T step, T... values> requires(step < 0 and start > stop and start + step <= stop)
-struct SeqHelper<T, start, stop, step, values...>
+template<typename T, T start, T stop, T step>
+constexpr T seqElement(const size_t i)
 {
-    using Type = FixedArray<T, values..., start>;
-};
+	if constexpr (std::integral<T>) { return seqValue<T, start, step>(i); }
+	else                            { return SeqValues<T, start, stop, step>::values[i]; }
+}
+
+/**
+ * @brief Builds the `FixedArray` of a sequence.
+ *
+ * The elements are expanded from a `std::make_index_sequence` (which compilers
+ * implement with `__make_integer_seq`/`__integer_pack`), so the template depth
+ * does not grow with the number of elements.
+ */
+template<typename T, T start, T stop, T step, typename Indices = std::make_index_sequence<seqSize<T, start, stop, step>()>> struct SeqHelper;
 
-template<typename T, T start, T stop, T step, T... values> requires(start == stop)
-struct SeqHelper<T, start, stop, step, values...>
+template<typename T, T start, T stop, T step, size_t... Is>
+struct SeqHelper<T, start, stop, step, std::index_sequence<Is...>>
 {
-    using Type = FixedArray<T, values...>;
+	using Type = FixedArray<T, seqElement<T, start, stop, step>(Is)...>;
 };
 
 } // namespace detail
@@ -47,8 +100,8 @@ struct SeqHelper<T, start, stop, step, values...>
  * @brief Generate a compile-time numeric sequence of type `T`.
  *
  * Produces a `FixedArray<T,...>` containing a compile-time constant sequence
- * starting at `start`, incrementing by `step`, and terminating according to
- * the rules documented in `SeqHelper`.
+ * starting at `start`, incrementing by `step`, and stopping before `stop`
+ * (`step` may be negative).
  *
  * Example:
  * @code
@@ -57,7 +110,7 @@ struct SeqHelper<T, start, stop, step, values...>
  *
  * @tparam T     Scalar type.
  * @tparam start Starting value.
- * @tparam stop  Boundary used for recursion termination.
+ * @tparam stop  Excluded bound of the sequence.
  * @tparam step  Step increment (default 1).
  */
 template<typename T, T start, T stop, T step=1> 
@@ -75,7 +128,7 @@ using Seq = typename detail::SeqHelper<T, start, stop, step>::Type;
  * @endcode
  *
  * @tparam start First index.
- * @tparam stop  Upper boundary for termination.
+ * @tparam stop  Excluded upper bound of the sequence.
  * @tparam step  Step increment (default 1).
  */
 template<size_t start, size_t stop, size_t step=1> 
@@ -0,0 +1,441 @@
+#ifndef BIC_SHAPE_HPP
+#define BIC_SHAPE_HPP
+
+/**
+ * @file Shape.hpp
+ * @brief Multidimensional shapes mixing `Fixed` and runtime extents, and their memory layouts.
+ * @date 2025
+ * @version 1.0
+ *
+ * `BIC::Shape<Extents...>` holds one extent per dimension, each either a
+ * `Fixed<size_t, N>` or a runtime `size_t`; only the runtime ones are stored.
+ * Extents, sizes, strides and offsets are computed with the `Fixed`
+ * operators, so every quantity that only depends on `Fixed` inputs is itself
+ * a `Fixed`: the stride of the last dimensions of a row-major shape is known
+ * at compile time even when the first extent is not.
+ *
+ * Three layouts map multidimensional indices to offsets:
+ *  - `LayoutRight`, row-major, the last index is contiguous,
+ *  - `LayoutLeft`, column-major, the first index is contiguous,
+ *  - `LayoutBlocked<BLOCKS...>`, the array is cut into blocks of compile-time
+ *    extents `BLOCKS...`, stored contiguously one after the other in
+ *    row-major order, each block being row-major itself, so that neighbouring
+ *    elements along any dimension are likely in the same cache lines.
+ *
+ * Each layout provides a `mapping` meeting the requirements of the layout
+ * mappings of `std::mdspan`. When the standard library provides `std::mdspan`
+ * a shape also converts from and to `std::extents`.
+ *
+ * Example:
+ * @code
+ * const BIC::Shape shape(n, BIC::fixed<size_t, 4>, BIC::fixed<size_t, 8>);
+ * const auto   stride = BIC::LayoutRight::stride<0>(shape);                                               // BIC::Fixed<size_t, 32>
+ * const size_t offset = BIC::LayoutRight::offset(shape, i, BIC::fixed<size_t, 1>, BIC::fixed<size_t, 2>); // i*32 + 10
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedSpan.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Mutable.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <tuple>       // for std::tuple_element_t
+#include <type_traits>
+#include <utility>
+#include <version>     // for __cpp_lib_mdspan
+
+#ifdef __cpp_lib_mdspan
+	#include <mdspan>
+#endif
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/**
+ * @brief Runtime extents of a shape, an empty class when there are none.
+ */
+template<size_t N>
+struct ShapeDynamicExtents
+{
+	std::array<size_t, N> values = {};
+
+	constexpr size_t&       operator[](const size_t i)       { return values[i]; }
+	constexpr const size_t& operator[](const size_t i) const { return values[i]; }
+};
+
+template<>
+struct ShapeDynamicExtents<0>
+{
+	constexpr size_t operator[](const size_t) const { return 0; }
+};
+
+/// An extent of a shape: a `size_t` or a `Fixed<size_t, N>`.
+template<typename Extent>
+concept ShapeExtent = std::same_as<Extent, size_t> or std::same_as<Mutable<Extent>, size_t>;
+
+/// Shape extent of a constructor argument: integral values become `size_t`, `Fixed` extents are kept.
+template<typename Extent>
+using ShapeExtentOf = std::conditional_t<IsFixed<Extent>::value, Extent, size_t>;
+
+/**
+ * @brief An index as used in offset computations: a `Fixed<size_t, I>` for a `Fixed`, a `size_t` otherwise.
+ */
+template<typename Index>
+constexpr auto toShapeIndex(const Index index)
+{
+	if constexpr (IsFixed<Index>::value) { return Fixed<size_t, static_cast<size_t>(Index::value)>{}; }
+	else                                 { return static_cast<size_t>(index); }
+}
+
+} // namespace detail
+
+/**
+ * @brief Extents of a multidimensional array, each one a `Fixed<size_t, N>` or a runtime `size_t`.
+ *
+ * @tparam Extents Extent of each dimension, the first one being the outermost for `LayoutRight`.
+ */
+template<typename... Extents>
+class Shape
+{
+	static_assert((detail::ShapeExtent<Extents> and ...), "BIC::Shape: every extent is a size_t or a Fixed<size_t, N>");
+
+public:
+	static constexpr size_t RANK         = sizeof...(Extents);                                    ///< @brief Number of dimensions.
+	static constexpr size_t DYNAMIC_RANK = ((IsFixed<Extents>::value ? 0 : 1) + ... + size_t(0)); ///< @brief Number of runtime extents.
+
+	/// Extent of each dimension, `std::dynamic_extent` for the runtime ones, as for `std::extents`.
+	static constexpr std::array<size_t, RANK> STATIC_EXTENTS = {detail::SPAN_EXTENT<Extents>...};
+
+	template<size_t I>
+	using Extent = std::tuple_element_t<I, std::tuple<Extents...>>; ///< @brief Type of the `I`-th extent.
+
+	static constexpr Fixed<size_t, RANK> rank = {}; ///< @brief Number of dimensions.
+
+private:
+	/// Position of the extent of each runtime dimension among the runtime extents, 0 for the others to stay in bounds.
+	static constexpr std::array<size_t, RANK> DYNAMIC_INDEX = []
+	{
+		std::array<size_t, RANK> index = {};
+		size_t k = 0;
+		for (size_t i = 0; i != RANK; ++i) { if (STATIC_EXTENTS[i] == std::dynamic_extent) { index[i] = k++; } }
+		return index;
+	}();
+
+	BIC_NO_UNIQUE_ADDRESS detail::ShapeDynamicExtents<DYNAMIC_RANK> dynamic_;
+
+public:
+	/**
+	 * @brief Shape whose runtime extents are 0.
+	 */
+	constexpr Shape() = default;
+
+	/**
+	 * @brief Shape of the given extents.
+	 */
+	constexpr explicit Shape(const Extents... extents) requires (sizeof...(Extents) > 0)
+	{
+		if constexpr (DYNAMIC_RANK > 0)
+		{
+			size_t k = 0;
+			([&]<typename E>(const E value)
+			{
+				if constexpr (not IsFixed<E>::value) { dynamic_[k++] = value; }
+			}(extents), ...);
+		}
+	}
+
+#ifdef __cpp_lib_mdspan
+	/**
+	 * @brief Shape of `std::extents` whose static extents match, runtime extents being read from `extents`.
+	 */
+	template<typename IndexType, size_t... E> requires (sizeof...(E) == RANK and ((E == std::dynamic_extent or E == detail::SPAN_EXTENT<Extents>) and ...))
+	constexpr Shape(const std::extents<IndexType, E...>& extents)
+	{
+		for (size_t i = 0; i != RANK; ++i)
+		{
+			if (STATIC_EXTENTS[i] == std::dynamic_extent) { dynamic_[DYNAMIC_INDEX[i]] = static_cast<size_t>(extents.extent(i)); }
+		}
+	}
+
+	/**
+	 * @brief Converts to `std::extents` with the same static extents.
+	 */
+	template<typename IndexType>
+	constexpr operator std::extents<IndexType, detail::SPAN_EXTENT<Extents>...>() const
+	{
+		std::array<IndexType, RANK> extents = {};
+		for (size_t i = 0; i != RANK; ++i) { extents[i] = static_cast<IndexType>(extent(i)); }
+		return std::extents<IndexType, detail::SPAN_EXTENT<Extents>...>(extents);
+	}
+#endif
+
+	/**
+	 * @brief Extent of the dimension `I`, a `Fixed` when it is known at compile time.
+	 */
+	template<size_t I>
+	constexpr Extent<I> extent(const Fixed<size_t, I> = {}) const
+	{
+		if constexpr (IsFixed<Extent<I>>::value) { return {}; }
+		else                                     { return dynamic_[DYNAMIC_INDEX[I]]; }
+	}
+
+	/**
+	 * @brief Extent of the dimension `i`.
+	 */
+	constexpr size_t extent(const size_t i) const
+	{
+		if (STATIC_EXTENTS[i] != std::dynamic_extent) { return STATIC_EXTENTS[i]; }
+		return dynamic_[DYNAMIC_INDEX[i]];
+	}
+
+	/**
+	 * @brief Product of the extents of the dimensions `[FIRST, LAST)`, a `Fixed` when they all are.
+	 */
+	template<size_t FIRST, size_t LAST>
+	constexpr auto product() const
+	{
+		if constexpr (FIRST >= LAST) { return Fixed<size_t, 1>{}; }
+		else                         { return extent<FIRST>() * product<FIRST + 1, LAST>(); }
+	}
+
+	/**
+	 * @brief Product of the extents of the dimensions `[first, last)`.
+	 */
+	constexpr size_t product(const size_t first, const size_t last) const
+	{
+		size_t product = 1;
+		for (size_t i = 0; i != RANK; ++i) { if (first <= i and i < last) { product *= extent(i); } }
+		return product;
+	}
+
+	/**
+	 * @brief Number of elements, a `Fixed` when every extent is.
+	 */
+	constexpr auto size() const { return product<0, RANK>(); }
+
+	template<typename... OtherExtents> requires (sizeof...(OtherExtents) == RANK)
+	friend constexpr bool operator==(const Shape& lhs, const Shape<OtherExtents...>& rhs)
+	{
+		for (size_t i = 0; i != RANK; ++i) { if (lhs.extent(i) != rhs.extent(i)) { return false; } }
+		return true;
+	}
+};
+
+template<typename... Extents> requires (std::integral<Mutable<Extents>> and ...)
+Shape(Extents...) -> Shape<detail::ShapeExtentOf<Extents>...>;
+
+#ifdef __cpp_lib_mdspan
+template<typename IndexType, size_t... E>
+Shape(std::extents<IndexType, E...>) -> Shape<detail::SpanExtent<E>...>;
+#endif
+
+namespace detail
+{
+
+/// `Shape` of a `Shape` or of `std::extents`.
+template<typename ExtentsType> struct ShapeOfTraits;
+
+template<typename... Extents>
+struct ShapeOfTraits<Shape<Extents...>>
+{
+	using Type      = Shape<Extents...>;
+	using IndexType = size_t;
+};
+
+#ifdef __cpp_lib_mdspan
+template<typename I, size_t... E>
+struct ShapeOfTraits<std::extents<I, E...>>
+{
+	using Type      = Shape<SpanExtent<E>...>;
+	using IndexType = I;
+};
+#endif
+
+template<typename ExtentsType>
+using ShapeOf = typename ShapeOfTraits<ExtentsType>::Type;
+
+/**
+ * @brief `sum_k indices[k] * strides[k]` where the stride of the dimension `K` is `Layout::stride<K>(shape)`.
+ */
+template<typename Layout, typename... Extents, typename... Indices, size_t... Ks>
+constexpr auto stridedOffset(const Shape<Extents...>& shape, std::index_sequence<Ks...>, const Indices... indices)
+{
+	return (Fixed<size_t, 0>{} + ... + (toShapeIndex(indices) * Layout::template stride<Ks>(shape)));
+}
+
+/**
+ * @brief Layout mapping meeting the requirements of `std::mdspan` for the layout `Layout`.
+ *
+ * @tparam Layout      One of the layouts of this file.
+ * @tparam ExtentsType A `Shape`, or `std::extents` when `std::mdspan` is available.
+ */
+template<typename Layout, typename ExtentsType>
+class LayoutMapping
+{
+public:
+	using extents_type = ExtentsType;
+	using shape_type   = ShapeOf<ExtentsType>;
+	using index_type   = typename ShapeOfTraits<ExtentsType>::IndexType;
+	using size_type    = std::make_unsigned_t<index_type>;
+	using rank_type    = size_t;
+	using layout_type  = Layout;
+
+	constexpr LayoutMapping() = default;
+
+	constexpr LayoutMapping(const extents_type& extents) : extents_(extents) {} ///< @brief Mapping of the array of extents `extents`.
+
+	constexpr const extents_type& extents() const noexcept { return extents_; } ///< @brief Extents of the array.
+
+	constexpr shape_type shape() const { return shape_type(extents_); } ///< @brief Extents of the array as a `Shape`.
+
+	/**
+	 * @brief Offset of the element at `indices`, a `Fixed` when the indices and the extents involved are.
+	 */
+	template<typename... Indices> requires (sizeof...(Indices) == shape_type::RANK)
+	constexpr auto offset(const Indices... indices) const { return Layout::offset(shape(), indices...); }
+
+	/**
+	 * @brief Offset of the element at `indices`.
+	 */
+	template<typename... Indices> requires (sizeof...(Indices) == shape_type::RANK)
+	constexpr index_type operator()(const Indices... indices) const { return static_cast<index_type>(offset(indices...)); }
+
+	/**
+	 * @brief Number of elements spanned by the array, padding included.
+	 */
+	constexpr index_type required_span_size() const { return static_cast<index_type>(Layout::requiredSize(shape())); }
+
+	static constexpr bool is_always_unique()     { return true; }
+	static constexpr bool is_always_exhaustive() { return Layout::IS_ALWAYS_EXHAUSTIVE; }
+	static constexpr bool is_always_strided()    { return Layout::IS_STRIDED; }
+
+	static constexpr bool is_unique()     { return true; }
+	constexpr bool        is_exhaustive() const { return static_cast<size_t>(required_span_size()) == static_cast<size_t>(shape().size()); }
+	static constexpr bool is_strided()    { return Layout::IS_STRIDED; }
+
+	/**
+	 * @brief Distance between two elements consecutive along the dimension `r`.
+	 */
+	constexpr index_type stride(const rank_type r) const requires (Layout::IS_STRIDED) { return static_cast<index_type>(Layout::stride(shape(), r)); }
+
+	template<typename OtherExtentsType>
+	friend constexpr bool operator==(const LayoutMapping& lhs, const LayoutMapping<Layout, OtherExtentsType>& rhs) { return lhs.shape() == rhs.shape(); }
+
+private:
+	BIC_NO_UNIQUE_ADDRESS extents_type extents_;
+};
+
+} // namespace detail
+
+/**
+ * @brief Row-major layout: the last index is contiguous.
+ */
+struct LayoutRight
+{
+	static constexpr bool IS_STRIDED           = true;
+	static constexpr bool IS_ALWAYS_EXHAUSTIVE = true;
+
+	/// Stride of the dimension `I`, the product of the following extents; a `Fixed` when they all are.
+	template<size_t I, typename... Extents>
+	static constexpr auto stride(const Shape<Extents...>& shape) { return shape.template product<I + 1, sizeof...(Extents)>(); }
+
+	/// Stride of the dimension `i`.
+	template<typename... Extents>
+	static constexpr size_t stride(const Shape<Extents...>& shape, const size_t i) { return shape.product(i + 1, sizeof...(Extents)); }
+
+	/// Offset of the element at `indices`, a `Fixed` when the indices and the extents involved are.
+	template<typename... Extents, typename... Indices> requires (sizeof...(Indices) == sizeof...(Extents))
+	static constexpr auto offset(const Shape<Extents...>& shape, const Indices... indices) { return detail::stridedOffset<LayoutRight>(shape, std::index_sequence_for<Extents...>{}, indices...); }
+
+	/// Number of elements spanned.
+	template<typename... Extents>
+	static constexpr auto requiredSize(const Shape<Extents...>& shape) { return shape.size(); }
+
+	template<typename ExtentsType>
+	using mapping = detail::LayoutMapping<LayoutRight, ExtentsType>; ///< @brief `std::mdspan` layout mapping.
+};
+
+/**
+ * @brief Column-major layout: the first index is contiguous.
+ */
+struct LayoutLeft
+{
+	static constexpr bool IS_STRIDED           = true;
+	static constexpr bool IS_ALWAYS_EXHAUSTIVE = true;
+
+	/// Stride of the dimension `I`, the product of the preceding extents; a `Fixed` when they all are.
+	template<size_t I, typename... Extents>
+	static constexpr auto stride(const Shape<Extents...>& shape) { return shape.template product<0, I>(); }
+
+	/// Stride of the dimension `i`.
+	template<typename... Extents>
+	static constexpr size_t stride(const Shape<Extents...>& shape, const size_t i) { return shape.product(0, i); }
+
+	/// Offset of the element at `indices`, a `Fixed` when the indices and the extents involved are.
+	template<typename... Extents, typename... Indices> requires (sizeof...(Indices) == sizeof...(Extents))
+	static constexpr auto offset(const Shape<Extents...>& shape, const Indices... indices) { return detail::stridedOffset<LayoutLeft>(shape, std::index_sequence_for<Extents...>{}, indices...); }
+
+	/// Number of elements spanned.
+	template<typename... Extents>
+	static constexpr auto requiredSize(const Shape<Extents...>& shape) { return shape.size(); }
+
+	template<typename ExtentsType>
+	using mapping = detail::LayoutMapping<LayoutLeft, ExtentsType>; ///< @brief `std::mdspan` layout mapping.
+};
+
+/**
+ * @brief Blocked (tiled) layout with blocks of extents `BLOCKS...`.
+ *
+ * The array is cut into blocks of `BLOCKS...` elements, the last blocks
+ * along each dimension being padded. Blocks are stored contiguously in
+ * row-major order, and the elements of a block in row-major order. Powers of
+ * two block extents make the index computations shifts and masks.
+ */
+template<size_t... BLOCKS>
+struct LayoutBlocked
+{
+	static_assert(((BLOCKS > 0) and ...), "BIC::LayoutBlocked: block extents must be positive");
+
+	static constexpr bool IS_STRIDED           = false;
+	static constexpr bool IS_ALWAYS_EXHAUSTIVE = false;
+
+	using Block = Shape<Fixed<size_t, BLOCKS>...>; ///< @brief Shape of a block.
+
+	/// Number of blocks along each dimension, a `Fixed` when the extent is.
+	template<typename... Extents>
+	static constexpr auto grid(const Shape<Extents...>& shape)
+	{
+		static_assert(sizeof...(Extents) == sizeof...(BLOCKS), "BIC::LayoutBlocked: one block extent per dimension");
+
+		return [&]<size_t... Ks>(std::index_sequence<Ks...>)
+		{
+			return Shape((shape.template extent<Ks>() + Fixed<size_t, BLOCKS - 1>{}) / Fixed<size_t, BLOCKS>{}...);
+		}(std::index_sequence_for<Extents...>{});
+	}
+
+	/// Offset of the element at `indices`, a `Fixed` when the indices and the extents involved are.
+	template<typename... Extents, typename... Indices> requires (sizeof...(Indices) == sizeof...(Extents))
+	static constexpr auto offset(const Shape<Extents...>& shape, const Indices... indices)
+	{
+		const auto block = LayoutRight::offset(grid(shape), (detail::toShapeIndex(indices) / Fixed<size_t, BLOCKS>{})...);
+		const auto inner = LayoutRight::offset(Block{},     (detail::toShapeIndex(indices) % Fixed<size_t, BLOCKS>{})...);
+		return block * Block{}.size() + inner;
+	}
+
+	/// Number of elements spanned, padding included.
+	template<typename... Extents>
+	static constexpr auto requiredSize(const Shape<Extents...>& shape) { return grid(shape).size() * Block{}.size(); }
+
+	template<typename ExtentsType>
+	using mapping = detail::LayoutMapping<LayoutBlocked, ExtentsType>; ///< @brief `std::mdspan` layout mapping.
+};
+
+} // namespace BIC
+
+#endif // BIC_SHAPE_HPP
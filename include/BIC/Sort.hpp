@@ -0,0 +1,176 @@
+#ifndef BIC_SORT_HPP
+#define BIC_SORT_HPP
+
+/**
+ * @file Sort.hpp
+ * @brief Sorting networks for arrays of compile-time size.
+ * @date 2025
+ * @version 1.0
+ *
+ * A sorting network is a fixed sequence of compare-exchange operations on
+ * pairs of positions that sorts any input. When the size of an array is a
+ * `Fixed`, `BIC::sort` generates Batcher's odd-even merge sort network at
+ * compile time and unrolls it into branchless min/max pairs, which the
+ * compiler keeps in registers and may vectorise. Runtime sizes fall back to
+ * an insertion sort, which is also the fastest generic sort for tiny arrays.
+ *
+ * Example:
+ * @code
+ * float window[9] = {...};
+ * BIC::sort(window, BIC::fixed<size_t, 9>); // unrolled compare-exchanges, no branch
+ * const float median = window[4];
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedArray.hpp>
+#include <BIC/Loops.hpp>
+#include <BIC/Seq.hpp>
+
+#include <array>
+#include <concepts>   // for std::copy_constructible
+#include <cstddef>
+#include <functional> // for std::less
+#include <utility>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/**
+ * @brief Comparators of Batcher's odd-even merge sort network on `N` elements.
+ *
+ * The network is generated for the next power of two and the comparators
+ * touching a position past `N` are dropped, which is equivalent to padding
+ * the input with elements greater than any other.
+ */
+template<size_t N>
+struct SortingNetworkPairs
+{
+	template<typename Visitor>
+	static constexpr void generate(Visitor&& visit)
+	{
+		size_t padded = 1;
+		while (padded < N) { padded *= 2; }
+
+		for (size_t p = 1; p < padded; p *= 2)
+		{
+			for (size_t k = p; k >= 1; k /= 2)
+			{
+				for (size_t j = k % p; j + k < padded; j += 2*k)
+				{
+					for (size_t i = 0; i < k and i + j + k < padded; ++i)
+					{
+						const size_t lo = i + j;
+						const size_t hi = i + j + k;
+						if (lo / (2*p) == hi / (2*p) and hi < N) { visit(lo, hi); }
+					}
+				}
+			}
+		}
+	}
+
+	static constexpr size_t COUNT = []
+	{
+		size_t count = 0;
+		generate([&](size_t, size_t) { ++count; });
+		return count;
+	}();
+
+	/// Flattened pairs: comparator `k` orders the positions `PAIRS[2*k]` and `PAIRS[2*k+1]`.
+	static constexpr std::array<size_t, 2*COUNT> PAIRS = []
+	{
+		std::array<size_t, 2*COUNT> pairs = {};
+		size_t i = 0;
+		generate([&](const size_t lo, const size_t hi) { pairs[i++] = lo; pairs[i++] = hi; });
+		return pairs;
+	}();
+};
+
+/**
+ * @brief Puts the smallest of `a` and `b` (according to `comp`) in `a` and the largest in `b`.
+ *
+ * Copyable elements are exchanged without branching, other elements are swapped.
+ */
+template<typename T, typename Compare>
+constexpr void compareExchange(T& a, T& b, Compare& comp)
+{
+	if constexpr (std::copy_constructible<T>)
+	{
+		// Two independent selects, rather than a swap on a shared condition, are lowered to min/max instructions
+		const T x = a;
+		const T y = b;
+		a = comp(y, x) ? y : x;
+		b = comp(y, x) ? x : y;
+	}
+	else
+	{
+		using std::swap;
+		if (comp(b, a)) { swap(a, b); }
+	}
+}
+
+} // namespace detail
+
+/**
+ * @brief Comparators of the sorting network on `N` elements, flattened as `lo0, hi0, lo1, hi1, ...`.
+ */
+template<size_t N>
+using SortingNetwork = typename detail::FixedArrayFromArray<detail::SortingNetworkPairs<N>::PAIRS>::Type;
+
+/**
+ * @brief Sorts the `N` elements at `data` with an unrolled sorting network.
+ *
+ * @param data Pointer to the first element.
+ * @param n    Number of elements, known at compile time.
+ * @param comp Strict weak ordering, `std::less<>` by default.
+ *
+ * The elements are moved into a local array, sorted by a sequence of
+ * branchless compare-exchanges and moved back, so that the whole network
+ * runs in registers for small `N`. `T` may be neither default
+ * constructible nor copyable.
+ */
+template<typename T, size_t N, typename Compare = std::less<>>
+constexpr void sort(T* const data, const Fixed<size_t, N> /* n */, Compare comp = {})
+{
+	if constexpr (N > 1)
+	{
+		using Pairs = detail::SortingNetworkPairs<N>;
+
+		std::array<T, N> values = [&]<size_t... Is>(FixedArray<size_t, Is...>)
+		{
+			return std::array<T, N>{std::move(data[Is])...};
+		}(indexSeq<0, N>);
+
+		foreach(indexSeq<0, Pairs::COUNT>, [&](const auto k)
+		{
+			detail::compareExchange(values[Pairs::PAIRS[2*k]], values[Pairs::PAIRS[2*k + 1]], comp);
+		});
+
+		for (size_t i = 0; i != N; ++i) { data[i] = std::move(values[i]); }
+	}
+}
+
+/**
+ * @brief Sorts the `n` elements at `data` with an insertion sort.
+ *
+ * Fallback for sizes only known at runtime. Insertion sort does the fewest
+ * moves on the tiny arrays sorting networks are meant for.
+ */
+template<typename T, typename Compare = std::less<>>
+constexpr void sort(T* const data, const size_t n, Compare comp = {})
+{
+	for (size_t i = 1; i < n; ++i)
+	{
+		T      value = std::move(data[i]);
+		size_t j     = i;
+		for (; j > 0 and comp(value, data[j - 1]); --j) { data[j] = std::move(data[j - 1]); }
+		data[j] = std::move(value);
+	}
+}
+
+} // namespace BIC
+
+#endif // BIC_SORT_HPP
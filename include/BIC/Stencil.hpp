@@ -0,0 +1,260 @@
+#ifndef BIC_STENCIL_HPP
+#define BIC_STENCIL_HPP
+
+/**
+ * @file Stencil.hpp
+ * @brief 1D and 2D stencils (convolutions) with compile-time taps.
+ * @date 2025
+ * @version 1.0
+ *
+ * A stencil computes every output element as a weighted sum of the input
+ * elements at fixed offsets around it. With the offsets and the weights
+ * given as `FixedArray`s, the sum is simplified at compile time:
+ *  - taps whose weight is zero are removed,
+ *  - taps sharing the same weight magnitude are summed (or subtracted) first
+ *    and multiplied once, so symmetric and antisymmetric taps are paired,
+ *  - weights of magnitude one need no multiplication at all.
+ *
+ * Outputs are processed in blocks of `BLOCK` columns: each block has a
+ * compile-time length, so its inner loop vectorises without remainder, and
+ * in 2D the rows of input touched by a block stay in cache while the block
+ * sweeps down the rows.
+ *
+ * The caller is responsible for the halo: `in[i + offset]` must be readable
+ * for every output index `i` and every offset.
+ *
+ * Example:
+ * @code
+ * // Laplacian, the 4 neighbours share the weight 1 and are added without multiplication
+ * BIC::stencil(in, inStride, out, outStride, rows, cols,
+ *              BIC::fixedArray<int, -1, 0, 0, 0, 1>,       // row offsets
+ *              BIC::fixedArray<int,  0,-1, 0, 1, 0>,       // column offsets
+ *              BIC::fixedArray<float, 1.f, 1.f, -4.f, 1.f, 1.f>);
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedArray.hpp>
+#include <BIC/Loops.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+inline constexpr size_t STENCIL_DEFAULT_BLOCK = 256; ///< @brief Default number of output columns processed per block.
+
+/**
+ * @brief A non-zero tap: the input at `(row, column)` relative to the output is added, or subtracted when `negative`.
+ */
+struct StencilTap
+{
+	ptrdiff_t row;
+	ptrdiff_t column;
+	bool      negative;
+};
+
+/**
+ * @brief Compile-time simplification of a stencil.
+ *
+ * Non-zero taps are grouped by the magnitude of their weight. Inside a group
+ * the taps with a positive weight come first; a group made of negative taps
+ * only is stored with a negative weight and positive taps instead, so that
+ * every group starts with an addition.
+ */
+template<typename RowOffsets, typename ColumnOffsets, typename Weights> struct StencilPlan;
+
+template<std::integral O, O... ROWS, std::integral P, P... COLUMNS, typename T, T... WEIGHTS>
+struct StencilPlan< FixedArray<O, ROWS...>, FixedArray<P, COLUMNS...>, FixedArray<T, WEIGHTS...> >
+{
+	static_assert(sizeof...(ROWS) == sizeof...(WEIGHTS) and sizeof...(COLUMNS) == sizeof...(WEIGHTS), "BIC::stencil: every tap needs one offset per dimension and one weight");
+
+	static constexpr size_t SIZE = sizeof...(WEIGHTS);
+
+	static constexpr std::array<T, SIZE> W = {WEIGHTS...};
+
+	static constexpr T magnitude(const T weight) { return weight < T(0) ? -weight : weight; }
+
+	static constexpr size_t TAPS = []
+	{
+		size_t taps = 0;
+		for (const T weight : W) { taps += weight != T(0) ? 1 : 0; }
+		return taps;
+	}();
+
+	static constexpr size_t GROUPS = []
+	{
+		size_t groups = 0;
+		for (size_t i = 0; i != SIZE; ++i)
+		{
+			bool first = W[i] != T(0);
+			for (size_t j = 0; j != i and first; ++j) { first = magnitude(W[j]) != magnitude(W[i]); }
+			groups += first ? 1 : 0;
+		}
+		return groups;
+	}();
+
+	struct Data
+	{
+		std::array<T, GROUPS>          weight = {};
+		std::array<size_t, GROUPS + 1> first  = {};
+		std::array<StencilTap, TAPS>   taps   = {};
+	};
+
+	static constexpr Data DATA = []
+	{
+		constexpr std::array<ptrdiff_t, SIZE> ROW    = {static_cast<ptrdiff_t>(ROWS)...};
+		constexpr std::array<ptrdiff_t, SIZE> COLUMN = {static_cast<ptrdiff_t>(COLUMNS)...};
+
+		Data data;
+		size_t group = 0;
+		size_t tap   = 0;
+		for (size_t i = 0; i != SIZE; ++i)
+		{
+			bool first = W[i] != T(0);
+			for (size_t j = 0; j != i and first; ++j) { first = magnitude(W[j]) != magnitude(W[i]); }
+			if (not first) { continue; }
+
+			const T m = magnitude(W[i]);
+
+			bool anyPositive = false;
+			for (size_t j = i; j != SIZE; ++j) { anyPositive = anyPositive or W[j] == m; }
+
+			data.weight[group] = anyPositive ? m : -m;
+			data.first[group]  = tap;
+			for (size_t j = i; j != SIZE; ++j) { if (W[j] ==  data.weight[group]) { data.taps[tap++] = StencilTap{ROW[j], COLUMN[j], false}; } }
+			for (size_t j = i; j != SIZE; ++j) { if (W[j] == -data.weight[group]) { data.taps[tap++] = StencilTap{ROW[j], COLUMN[j], true}; } }
+			++group;
+		}
+		data.first[GROUPS] = tap;
+		return data;
+	}();
+
+	template<size_t I, typename Value>
+	static constexpr void accumulate(Value& sum, const Value* const p, const ptrdiff_t stride)
+	{
+		constexpr StencilTap TAP = DATA.taps[I];
+
+		const Value x = p[TAP.row*stride + TAP.column];
+		if constexpr (TAP.negative) { sum -= x; }
+		else                         { sum += x; }
+	}
+
+	template<size_t G, typename Value, size_t... Ks>
+	static constexpr Value groupSum(const Value* const p, const ptrdiff_t stride, std::index_sequence<Ks...>)
+	{
+		constexpr StencilTap FIRST = DATA.taps[DATA.first[G]];
+
+		Value sum = p[FIRST.row*stride + FIRST.column];
+		(accumulate<DATA.first[G] + 1 + Ks>(sum, p, stride), ...);
+		return sum;
+	}
+
+	/// Weighted sum of the taps of group `G`; the first group initialises `result`, the others are added to it.
+	template<size_t G, typename Value>
+	static constexpr void addGroup(Value& result, const Value* const p, const ptrdiff_t stride)
+	{
+		constexpr T WEIGHT = DATA.weight[G];
+
+		const Value sum = groupSum<G>(p, stride, std::make_index_sequence<DATA.first[G + 1] - DATA.first[G] - 1>{});
+
+		if constexpr (G == 0)
+		{
+			if constexpr (WEIGHT == T(1))       { result = sum; }
+			else if constexpr (WEIGHT == T(-1)) { result = -sum; }
+			else                                { result = static_cast<Value>(WEIGHT)*sum; }
+		}
+		else
+		{
+			if constexpr (WEIGHT == T(1))       { result += sum; }
+			else if constexpr (WEIGHT == T(-1)) { result -= sum; }
+			else                                { result += static_cast<Value>(WEIGHT)*sum; }
+		}
+	}
+
+	template<typename Value, size_t... Gs>
+	static constexpr Value apply([[maybe_unused]] const Value* const p, [[maybe_unused]] const ptrdiff_t stride, std::index_sequence<Gs...>)
+	{
+		Value result = Value(0);
+		(addGroup<Gs>(result, p, stride), ...);
+		return result;
+	}
+
+	/**
+	 * @brief Output of the stencil centred on `p`, `stride` being the distance between two rows of input.
+	 */
+	template<typename Value>
+	static constexpr Value apply(const Value* const p, const ptrdiff_t stride)
+	{
+		return apply(p, stride, std::make_index_sequence<GROUPS>{});
+	}
+};
+
+} // namespace detail
+
+/**
+ * @brief 1D stencil: `out[i] = sum_t weights[t] * in[i + offsets[t]]` for `i` in `[0, n)`.
+ *
+ * @param in      Input, readable from `in + min(offsets)` to `in + n + max(offsets)`.
+ * @param out     Output of `n` elements.
+ * @param n       Number of outputs, a runtime value or a `Fixed`.
+ * @param offsets Offset of each tap.
+ * @param weights Weight of each tap.
+ * @param block   Number of outputs per block.
+ */
+template<typename Value, typename Size, std::integral O, O... OFFSETS, typename T, T... WEIGHTS, size_t BLOCK = detail::STENCIL_DEFAULT_BLOCK>
+constexpr void stencil(const Value* const in, Value* const out, const Size n, const FixedArray<O, OFFSETS...> /* offsets */, const FixedArray<T, WEIGHTS...> /* weights */, const Fixed<size_t, BLOCK> block = {})
+{
+	using Plan = detail::StencilPlan< FixedArray<O, static_cast<O>(0*OFFSETS)...>, FixedArray<O, OFFSETS...>, FixedArray<T, WEIGHTS...> >;
+
+	foreachTiled(size_t(0), static_cast<size_t>(n), block, [&](const size_t i, const auto length)
+	{
+		for (size_t k = 0; k < length; ++k) { out[i + k] = Plan::apply(in + i + k, 0); }
+	});
+}
+
+/**
+ * @brief 2D stencil: `out(r, c) = sum_t weights[t] * in(r + rowOffsets[t], c + columnOffsets[t])`.
+ *
+ * @param in            Input, row-major, rows `inStride` elements apart.
+ * @param inStride      Distance between two rows of input.
+ * @param out           Output, row-major, rows `outStride` elements apart.
+ * @param outStride     Distance between two rows of output.
+ * @param rows          Number of output rows.
+ * @param columns       Number of output columns.
+ * @param rowOffsets    Row offset of each tap.
+ * @param columnOffsets Column offset of each tap.
+ * @param weights       Weight of each tap.
+ * @param block         Number of output columns per block.
+ *
+ * The output is swept block of columns by block of columns, each block from
+ * the first row to the last, so that the input rows read by a block are
+ * reused from cache by the next output rows.
+ */
+template<typename Value, typename Rows, typename Columns, std::integral O, O... ROWS, std::integral P, P... COLUMNS, typename T, T... WEIGHTS, size_t BLOCK = detail::STENCIL_DEFAULT_BLOCK>
+constexpr void stencil(const Value* const in, const ptrdiff_t inStride, Value* const out, const ptrdiff_t outStride, const Rows rows, const Columns columns,
+                       const FixedArray<O, ROWS...> /* rowOffsets */, const FixedArray<P, COLUMNS...> /* columnOffsets */, const FixedArray<T, WEIGHTS...> /* weights */, const Fixed<size_t, BLOCK> block = {})
+{
+	using Plan = detail::StencilPlan< FixedArray<O, ROWS...>, FixedArray<P, COLUMNS...>, FixedArray<T, WEIGHTS...> >;
+
+	foreachTiled(size_t(0), static_cast<size_t>(columns), block, [&](const size_t j, const auto length)
+	{
+		for (ptrdiff_t r = 0; r < static_cast<ptrdiff_t>(rows); ++r)
+		{
+			const Value* const source = in  + r*inStride  + j;
+			Value* const       target = out + r*outStride + j;
+
+			for (size_t k = 0; k < length; ++k) { target[k] = Plan::apply(source + k, inStride); }
+		}
+	});
+}
+
+} // namespace BIC
+
+#endif // BIC_STENCIL_HPP
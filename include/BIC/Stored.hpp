@@ -0,0 +1,128 @@
+#ifndef BIC_STORED_HPP
+#define BIC_STORED_HPP
+
+/**
+ * @file Stored.hpp
+ * @brief Member holder that takes no space when its value is a `Fixed`.
+ * @date 2025
+ * @version 1.0
+ *
+ * A descriptor whose sizes, strides or scales may be `Fixed` or runtime
+ * values would normally spend a full word on each of them. `BIC::Stored<T>`
+ * holds a value of type `T` and is an empty class when `T` is a `Fixed`, so
+ * a member declared with `BIC_NO_UNIQUE_ADDRESS` takes no space at all and
+ * `get()` still returns the `Fixed`, keeping its value known at compile time.
+ *
+ * Two members of the same type must have distinct addresses, even when they
+ * are empty: members that may hold the same `Fixed` are given distinct `ID`s.
+ *
+ * Example:
+ * @code
+ * template<typename Rows, typename Columns>
+ * struct MatrixView
+ * {
+ *     float* data;
+ *     BIC_NO_UNIQUE_ADDRESS BIC::Stored<Rows, 0>    rows;
+ *     BIC_NO_UNIQUE_ADDRESS BIC::Stored<Columns, 1> columns;
+ * };
+ *
+ * static_assert(sizeof(MatrixView<BIC::Fixed<size_t, 4>, BIC::Fixed<size_t, 4>>) == sizeof(float*));
+ * static_assert(sizeof(MatrixView<size_t, BIC::Fixed<size_t, 4>>) == sizeof(float*) + sizeof(size_t));
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Mutable.hpp>
+
+#include <cstddef>
+
+/**
+ * @brief `[[no_unique_address]]`, spelled `[[msvc::no_unique_address]]` for MSVC which ignores the standard attribute.
+ */
+#ifndef BIC_NO_UNIQUE_ADDRESS
+	#if defined(_MSC_VER)
+		#define BIC_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+	#else
+		#define BIC_NO_UNIQUE_ADDRESS [[no_unique_address]]
+	#endif
+#endif
+
+namespace BIC
+{
+
+/**
+ * @brief Holds a value of type `T`, taking no space when `T` is a `Fixed`.
+ *
+ * @tparam T  A `Fixed` or any runtime type.
+ * @tparam ID Distinguishes members of a same class holding the same type, so that empty ones may share their address.
+ */
+template<typename T, size_t ID = 0>
+class Stored
+{
+	BIC_NO_UNIQUE_ADDRESS T value_ = {};
+
+public:
+	using Type = T; ///< @brief Type of the held value, possibly a `Fixed`.
+
+	static constexpr bool IS_FIXED = false; ///< @brief Whether the value is known at compile time and nothing is stored.
+
+	constexpr Stored() = default;
+
+	constexpr Stored(const T value) : value_(value) {} ///< @brief Holds `value`.
+
+	constexpr T get() const { return value_; } ///< @brief The held value.
+
+	constexpr operator T() const { return value_; } ///< @brief Implicit conversion to the held value.
+
+	/**
+	 * @brief Replaces the held value.
+	 */
+	constexpr Stored& operator=(const T value)
+	{
+		value_ = value;
+		return *this;
+	}
+};
+
+/**
+ * @brief Holds a `Fixed`: an empty class, without any member so that it may overlap any other member.
+ */
+template<typename T, T VALUE, size_t ID>
+class Stored<Fixed<T, VALUE>, ID>
+{
+public:
+	using Type = Fixed<T, VALUE>; ///< @brief Type of the held value.
+
+	static constexpr bool IS_FIXED = true; ///< @brief Whether the value is known at compile time and nothing is stored.
+
+	constexpr Stored() = default;
+
+	constexpr Stored(const Fixed<T, VALUE>) {} ///< @brief Holds the `Fixed`, nothing is stored.
+
+	constexpr Fixed<T, VALUE> get() const { return {}; } ///< @brief The held `Fixed`.
+
+	constexpr operator T() const { return VALUE; } ///< @brief Implicit conversion to the value.
+
+	/**
+	 * @brief Assigning the `Fixed` itself, the only possible value, is a no-op.
+	 */
+	constexpr Stored& operator=(const Fixed<T, VALUE>) { return *this; }
+};
+
+template<typename T> Stored(T) -> Stored<T>;
+
+namespace detail
+{
+
+template<typename T, size_t ID>
+struct MutableTraits<Stored<T, ID>>
+{
+	using Type = Mutable<T>;
+};
+
+} // namespace detail
+
+} // namespace BIC
+
+#endif // BIC_STORED_HPP
@@ -0,0 +1,81 @@
+#ifndef BIC_TABULATE_HPP
+#define BIC_TABULATE_HPP
+
+/**
+ * @file Tabulate.hpp
+ * @brief Lookup tables computed at compile time.
+ * @date 2025
+ * @version 1.0
+ *
+ * `BIC::tabulate(indices, f)` evaluates the constexpr callable `f` at every
+ * index of the `FixedArray` `indices`, e.g. a `seq`, each index being passed
+ * as a `Fixed`, and returns a reference to a `static constexpr std::array`
+ * holding the results. The table is part of the binary, in read-only data,
+ * and is neither computed at startup nor written on first use.
+ *
+ * `BIC::tabulateFixed(indices, f)` returns the results as a `FixedArray`
+ * instead, so that they can keep being used at compile time.
+ *
+ * Example:
+ * @code
+ * const auto& crc32 = BIC::tabulate(BIC::seq<uint32_t, 0, 256>, [](const uint32_t byte)
+ * {
+ *     uint32_t crc = byte;
+ *     for (int k = 0; k != 8; ++k) { crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320u : 0u); }
+ *     return crc;
+ * });                                                    // const std::array<uint32_t, 256>&
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedArray.hpp>
+#include <BIC/IsFixed.hpp>
+#include <BIC/Mutable.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/**
+ * @brief Values of `Func` at every index of `Indices`, in their common type.
+ *
+ * @tparam Func Default constructible constexpr callable, e.g. a captureless lambda.
+ */
+template<typename Indices, typename Func>
+struct Table;
+
+template<typename T, T... VALUES, typename Func>
+struct Table< FixedArray<T, VALUES...>, Func >
+{
+	using Type = std::common_type_t<Mutable<std::invoke_result_t<const Func&, Fixed<T, VALUES>>>...>;
+
+	static constexpr std::array<Type, sizeof...(VALUES)> values = {static_cast<Type>(Func{}(Fixed<T, VALUES>{}))...};
+};
+
+} // namespace detail
+
+/**
+ * @brief Table of the values of `Func` at every index of `indices`, stored in read-only data.
+ *
+ * @tparam Func Default constructible constexpr callable, e.g. a captureless lambda, called with a `Fixed` index.
+ *
+ * Every call with the same `indices` and `Func` returns the same table.
+ */
+template<typename T, T... VALUES, typename Func>
+constexpr const auto& tabulate(const FixedArray<T, VALUES...>, const Func) { return detail::Table< FixedArray<T, VALUES...>, Func >::values; }
+
+/**
+ * @brief Values of `Func` at every index of `indices`, as a `FixedArray`.
+ */
+template<typename T, T... VALUES, typename Func>
+constexpr typename detail::FixedArrayFromArray<detail::Table< FixedArray<T, VALUES...>, Func >::values>::Type tabulateFixed(const FixedArray<T, VALUES...>, const Func) { return {}; }
+
+} // namespace BIC
+
+#endif // BIC_TABULATE_HPP
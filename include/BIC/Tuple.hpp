@@ -0,0 +1,139 @@
+#ifndef BIC_TUPLE_HPP
+#define BIC_TUPLE_HPP
+
+/**
+ * @file Tuple.hpp
+ * @brief Enumeration, transformation and zipping of tuple-likes with `Fixed` indices.
+ * @date 2025
+ * @version 1.0
+ *
+ * These algorithms apply to any tuple-like type: `std::tuple`, `std::pair`,
+ * `std::array`, or a type providing `std::tuple_size` and `get`. They take
+ * the tuple by forwarding reference, so that nothing is copied and rvalue
+ * elements are moved, and expand a fold expression over an `IndexSeq`
+ * instead of recursing once per element, so that neither the copies nor the
+ * instantiation depth grow with the size of the tuple.
+ *
+ * Example:
+ * @code
+ * std::tuple<int, double, std::string> t(1, -2.9, "C");
+ *
+ * BIC::enumerate(t, [](const auto i, const auto& ti) { fmt::print("{}: {}\n", i, ti); }); // i is a Fixed<size_t, I>
+ *
+ * const auto doubled = BIC::transform(t, [](const auto& ti) { return ti + ti; });        // std::tuple<int, double, std::string>
+ * @endcode
+ */
+
+#include <BIC/Fixed.hpp>
+#include <BIC/FixedArray.hpp>
+#include <BIC/Seq.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace BIC
+{
+
+namespace detail
+{
+
+/// A type with a `std::tuple_size`, whose elements are accessed with `get`.
+template<typename Tuple>
+concept TupleLike = requires { std::tuple_size<std::remove_cvref_t<Tuple>>::value; };
+
+template<typename Tuple>
+inline constexpr size_t TUPLE_SIZE = std::tuple_size_v<std::remove_cvref_t<Tuple>>;
+
+/// `I`-th element of `tuple`, as found by `std::get` or by argument dependent lookup.
+template<size_t I, typename Tuple>
+constexpr decltype(auto) tupleGet(Tuple&& tuple)
+{
+	using std::get;
+	return get<I>(std::forward<Tuple>(tuple));
+}
+
+template<size_t I, typename Tuple, typename Func>
+constexpr decltype(auto) transformElement(Tuple&& tuple, Func& func)
+{
+	if constexpr (std::invocable<Func&, Fixed<size_t, I>, decltype(tupleGet<I>(std::forward<Tuple>(tuple)))>) { return func(fixed<size_t, I>, tupleGet<I>(std::forward<Tuple>(tuple))); }
+	else                                                                                                      { return func(tupleGet<I>(std::forward<Tuple>(tuple))); }
+}
+
+template<size_t I, typename... Tuples>
+constexpr auto zipElement(Tuples&&... tuples) { return std::forward_as_tuple(tupleGet<I>(std::forward<Tuples>(tuples))...); }
+
+} // namespace detail
+
+/**
+ * @brief Calls `func(i, element)` for every element of `tuple`, in order, `i` being its `Fixed<size_t, I>` index.
+ *
+ * The elements of an rvalue `tuple` are passed as rvalues.
+ */
+template<detail::TupleLike Tuple, typename BinaryFunc>
+constexpr BinaryFunc&& enumerate(Tuple&& tuple, BinaryFunc&& func)
+{
+	[&]<size_t... Is>(FixedArray<size_t, Is...>)
+	{
+		(func(fixed<size_t, Is>, detail::tupleGet<Is>(std::forward<Tuple>(tuple))), ...);
+	}(indexSeq<0, detail::TUPLE_SIZE<Tuple>>);
+
+	return std::forward<BinaryFunc>(func);
+}
+
+/**
+ * @brief Calls `func(i, element)` for every element of `tuple`, from the last one to the first one.
+ */
+template<detail::TupleLike Tuple, typename BinaryFunc>
+constexpr BinaryFunc&& reverseEnumerate(Tuple&& tuple, BinaryFunc&& func)
+{
+	constexpr size_t N = detail::TUPLE_SIZE<Tuple>;
+
+	[&]<size_t... Is>(FixedArray<size_t, Is...>)
+	{
+		(func(fixed<size_t, N - 1 - Is>, detail::tupleGet<N - 1 - Is>(std::forward<Tuple>(tuple))), ...);
+	}(indexSeq<0, N>);
+
+	return std::forward<BinaryFunc>(func);
+}
+
+/**
+ * @brief Tuple of the results of `func` applied to every element of `tuple`, in order.
+ *
+ * `func` is called as `func(i, element)` when it accepts the `Fixed<size_t, I>`
+ * index of the element, as `func(element)` otherwise. The results are stored
+ * with the type returned by `func`, references included.
+ */
+template<detail::TupleLike Tuple, typename Func>
+constexpr auto transform(Tuple&& tuple, Func&& func)
+{
+	return [&]<size_t... Is>(FixedArray<size_t, Is...>)
+	{
+		// Braced initialisation evaluates the calls in order
+		return std::tuple<decltype(detail::transformElement<Is>(std::forward<Tuple>(tuple), func))...>{detail::transformElement<Is>(std::forward<Tuple>(tuple), func)...};
+	}(indexSeq<0, detail::TUPLE_SIZE<Tuple>>);
+}
+
+/**
+ * @brief Tuple whose `I`-th element is the tuple of references to the `I`-th elements of `tuples`.
+ *
+ * Like `std::forward_as_tuple`, the result refers to the elements of `tuples`
+ * and must not outlive temporaries passed as arguments; it is typically
+ * consumed right away, e.g. by `enumerate`.
+ */
+template<detail::TupleLike Tuple, detail::TupleLike... Tuples>
+constexpr auto zip(Tuple&& tuple, Tuples&&... tuples)
+{
+	static_assert(((detail::TUPLE_SIZE<Tuples> == detail::TUPLE_SIZE<Tuple>) and ...), "BIC::zip: the tuples must have the same size");
+
+	return [&]<size_t... Is>(FixedArray<size_t, Is...>)
+	{
+		return std::tuple<decltype(detail::zipElement<Is>(std::forward<Tuple>(tuple), std::forward<Tuples>(tuples)...))...>{detail::zipElement<Is>(std::forward<Tuple>(tuple), std::forward<Tuples>(tuples)...)...};
+	}(indexSeq<0, detail::TUPLE_SIZE<Tuple>>);
+}
+
+} // namespace BIC
+
+#endif // BIC_TUPLE_HPP